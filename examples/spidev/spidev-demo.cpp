@@ -0,0 +1,74 @@
+/**
+ *  @filename   :   spidev-demo.cpp
+ *  @brief      :   4.2inch e-paper display (B) from Linux through /dev/spidev
+ *
+ *  Build on the Pi (or any Linux box for the test mode) with
+ *    g++ -O2 -DEPDIF_SPIDEV -Isrc/linux -Isrc examples/spidev/spidev-demo.cpp \
+ *        src/linux/spidev.cpp src/epdif.cpp src/epdpaint.cpp src/epddiff.cpp \
+ *        src/epddisplaylist.cpp src/epd4in2b.cpp src/font*.c -o spidev-demo
+ *
+ *  ./spidev-demo          drives the panel on /dev/spidev0.0, BCM pins below
+ *  ./spidev-demo <file>   test mode, writes the SPI traffic to <file>
+ *                         (e.g. /dev/null) and prints the syscall count
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <SPI.h>
+#include "epd4in2b.h"
+#include "epdpaint.h"
+
+#define RST_PIN         17
+#define DC_PIN          25
+#define BUSY_PIN        24
+
+#define COLORED     0
+#define UNCOLORED   1
+
+static unsigned char black[EPD_WIDTH * EPD_HEIGHT / 8];
+static unsigned char red[EPD_WIDTH * EPD_HEIGHT / 8];
+
+int main(int argc, char** argv) {
+  bool fake = argc > 1;
+  int fd = fake ? open(argv[1], O_WRONLY | O_CREAT | O_TRUNC, 0644) : -1;
+
+  // spidev drives CS, in test mode there are no pins at all
+  Epd epd(SPI, -1, fake ? -1 : DC_PIN, fake ? -1 : RST_PIN, fake ? -1 : BUSY_PIN);
+
+  SPI.setClockSpeed(8000000);
+  SPI.setChunkSize(4096);
+  if (fake && !SPI.beginFake(fd)) {
+    perror(argv[1]);
+    return 1;
+  }
+  if (!epd.Init()) {
+    fprintf(stderr, "e-Paper init failed\n");
+    return 1;
+  }
+
+  Paint paintBlack(black, EPD_WIDTH, EPD_HEIGHT);
+  Paint paintRed(red, EPD_WIDTH, EPD_HEIGHT);
+  paintBlack.Clear(UNCOLORED);
+  paintRed.Clear(UNCOLORED);
+  paintBlack.DrawStringAt(100, 40, "e-Paper Demo", &Font24, COLORED);
+  paintRed.DrawFilledRectangle(100, 80, 300, 120, COLORED);
+  paintRed.DrawStringAt(110, 90, "Hello Pi!", &Font24, UNCOLORED);
+
+  uint32_t messages = SPI.GetMessages();
+  uint32_t start = micros();
+  epd.DisplayFrame(black, red);
+  uint32_t elapsed = micros() - start;
+
+  printf("frame: %u bytes in %u SPI messages, %u us\n",
+         (unsigned)(2 * sizeof(black)), (unsigned)(SPI.GetMessages() - messages), (unsigned)elapsed);
+
+  epd.WaitUntilIdle();
+  epd.Sleep();
+  if (fd >= 0) close(fd);
+  return 0;
+}
+
+/* END OF FILE */
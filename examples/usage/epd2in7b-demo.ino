@@ -37,7 +37,7 @@ void setup() {
   Serial.begin(9600);
   Epd epd;
 
-  if (epd.Init() != 0) {
+  if (!epd.Init()) {
     Serial.print("e-Paper init failed");
     return;
   }
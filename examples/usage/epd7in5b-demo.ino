@@ -32,7 +32,7 @@ void setup() {
   // put your setup code here, to run once:
     Serial.begin(9600);
     Epd epd;
-    if (epd.Init() != 0) {
+    if (!epd.Init()) {
         Serial.print("e-Paper init failed");
         return;
     }
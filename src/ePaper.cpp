@@ -7,7 +7,9 @@
  * Constructor.
  */
 EPaper::EPaper()
+  : stats(NULL), statsPaint(NULL), statsVersion(0)
 {
+  statsJson[0] = '\0';
   // be sure not to call anything that requires hardware be initialized here, put those in begin()
 }
 
@@ -27,6 +29,7 @@ void EPaper::process()
 {
     // do something useful
     Serial.println("called process");
+    updateStats();
     doit();
 }
 
@@ -37,3 +40,46 @@ void EPaper::doit()
 {
     Serial.println("called doit");
 }
+
+/**
+ * Registers the cloud variable, call it from setup()
+ */
+bool EPaper::publishStats(const EpdStats& stats, Paint* paint)
+{
+    this->stats = &stats;
+    this->statsPaint = paint;
+    this->statsVersion = 0;
+    updateStats();
+    return Particle.variable("epdStats", statsJson);
+}
+
+/**
+ * Refreshes statsJson when a refresh, a command or a wait happened since
+ * the last call, so process() stays cheap
+ */
+void EPaper::updateStats()
+{
+    if (stats == NULL) return;
+
+    uint32_t version = stats->commands + stats->fullRefreshes + stats->partialRefreshes + (uint32_t)stats->waitUs;
+    if (version == statsVersion && statsJson[0]) return;
+    statsVersion = version;
+
+    static_assert(EPD_STATS_BUCKETS == 8, "update the histogram format");
+    const uint32_t* h = stats->refreshHistogram;
+    snprintf(statsJson, sizeof(statsJson),
+        "{\"cmd\":%lu,\"data\":%lu,\"black\":%lu,\"red\":%lu,\"other\":%lu,"
+        "\"waitMs\":%lu,\"delayMs\":%lu,\"full\":%lu,\"partial\":%lu,"
+        "\"refMs\":[%lu,%lu,%lu],\"hist\":[%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu],\"pixels\":%lu}",
+        (unsigned long)stats->commands, (unsigned long)stats->dataCalls,
+        (unsigned long)stats->bytes[EPD_STATS_BLACK], (unsigned long)stats->bytes[EPD_STATS_RED],
+        (unsigned long)stats->bytes[EPD_STATS_OTHER],
+        (unsigned long)(stats->waitUs / 1000), (unsigned long)(stats->delayUs / 1000),
+        (unsigned long)stats->fullRefreshes, (unsigned long)stats->partialRefreshes,
+        (unsigned long)stats->refreshLastMs,
+        (unsigned long)(stats->refreshMinMs == UINT32_MAX ? 0 : stats->refreshMinMs),
+        (unsigned long)stats->refreshMaxMs,
+        (unsigned long)h[0], (unsigned long)h[1], (unsigned long)h[2], (unsigned long)h[3],
+        (unsigned long)h[4], (unsigned long)h[5], (unsigned long)h[6], (unsigned long)h[7],
+        (unsigned long)(statsPaint != NULL ? statsPaint->GetPixelCount() : 0));
+}
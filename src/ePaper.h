@@ -27,9 +27,26 @@ public:
    */
   void process();
 
+  /**
+   * Publishes the counters of a panel (epd.GetStats()) and optionally the
+   * pixel count of a Paint as the JSON cloud variable "epdStats",
+   * process() keeps it up to date
+   */
+  bool publishStats(const EpdStats& stats, Paint* paint = NULL);
+
 private:
   /**
    * Example private method
    */
   void doit();
+
+  /**
+   * Formats the stats into statsJson if they changed
+   */
+  void updateStats();
+
+  const EpdStats* stats;
+  Paint*          statsPaint;
+  uint32_t        statsVersion;
+  char            statsJson[384];
 };
@@ -27,171 +27,33 @@
 #include <stdlib.h>
 #include "epd1in54b.h"
 
-Epd::~Epd() {
-};
-
-Epd::Epd() {
-    reset_pin = RST_PIN;
-    dc_pin = DC_PIN;
-    cs_pin = CS_PIN;
-    busy_pin = BUSY_PIN;
-    width = EPD_WIDTH;
-    height = EPD_HEIGHT;
-};
-
-int Epd::Init(void) {
+bool Epd1in54b::Init(void) {
     /* this calls the peripheral hardware interface, see epdif */
-    if (IfInit() != 0) {
-        return -1;
+    if (!IfInit()) {
+        return false;
     }
     /* EPD hardware init start */
-    Reset();
-    SendCommand(POWER_SETTING);
-    SendData(0x07);
-    SendData(0x00);
-    SendData(0x08);
-    SendData(0x00);
-    SendCommand(BOOSTER_SOFT_START);
-    SendData(0x07);
-    SendData(0x07);
-    SendData(0x07);
-    SendCommand(POWER_ON);
-
-    WaitUntilIdle();
-
-    SendCommand(PANEL_SETTING);
-    SendData(0xcf);
-    SendCommand(VCOM_AND_DATA_INTERVAL_SETTING);
-    SendData(0x17);
-    SendCommand(PLL_CONTROL);
-    SendData(0x39);
-    SendCommand(TCON_RESOLUTION);
-    SendData(0xC8);
-    SendData(0x00);
-    SendData(0xC8);
-    SendCommand(VCM_DC_SETTING_REGISTER);
-    SendData(0x0E);
-
-    SetLutBw();
-    SetLutRed();
+    Wake();
+    RunScript(INIT);
+    if (!isLutLoaded()) {
+        SetLutBw();
+        SetLutRed();
+    }
     /* EPD hardware init end */
 
-    return 0;
+    return true;
 }
 
 /**
- *  @brief: basic function for sending commands
+ *  @brief: set the look-up tables, the red ones always go along with
+ *          the black and white ones
  */
-void Epd::SendCommand(unsigned char command) {
-    DigitalWrite(dc_pin, LOW);
-    SpiTransfer(command);
+void Epd1in54b::SetLutBw(void) {
+    RunScript(LUT_BW);
 }
 
-/**
- *  @brief: basic function for sending data
- */
-void Epd::SendData(unsigned char data) {
-    DigitalWrite(dc_pin, HIGH);
-    SpiTransfer(data);
-}
-
-/**
- *  @brief: Wait until the busy_pin goes HIGH
- */
-void Epd::WaitUntilIdle(void) {
-    while(DigitalRead(busy_pin) == 0) {      //0: busy, 1: idle
-        DelayMs(100);
-    }      
-}
-
-/**
- *  @brief: module reset.
- *          often used to awaken the module in deep sleep,
- *          see Epd::Sleep();
- */
-void Epd::Reset(void) {
-    DigitalWrite(reset_pin, LOW);                //module reset    
-    DelayMs(200);
-    DigitalWrite(reset_pin, HIGH);
-    DelayMs(200);    
-}
-
-/**
- *  @brief: set the look-up tables
- */
-void Epd::SetLutBw(void) {
-    unsigned int count;     
-    SendCommand(0x20);         //g vcom
-    for(count = 0; count < 15; count++) {
-        SendData(lut_vcom0[count]);
-    } 
-    SendCommand(0x21);        //g ww --
-    for(count = 0; count < 15; count++) {
-        SendData(lut_w[count]);
-    } 
-    SendCommand(0x22);         //g bw r
-    for(count = 0; count < 15; count++) {
-        SendData(lut_b[count]);
-    } 
-    SendCommand(0x23);         //g wb w
-    for(count = 0; count < 15; count++) {
-        SendData(lut_g1[count]);
-    } 
-    SendCommand(0x24);         //g bb b
-    for(count = 0; count < 15; count++) {
-        SendData(lut_g2[count]);
-    } 
-}
-
-void Epd::SetLutRed(void) {
-    unsigned int count;     
-    SendCommand(0x25);
-    for(count = 0; count < 15; count++) {
-        SendData(lut_vcom1[count]);
-    } 
-    SendCommand(0x26);
-    for(count = 0; count < 15; count++) {
-        SendData(lut_red0[count]);
-    } 
-    SendCommand(0x27);
-    for(count = 0; count < 15; count++) {
-        SendData(lut_red1[count]);
-    } 
-}
-
-void Epd::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red) {
-    unsigned char temp;
-    if (frame_buffer_black != NULL) {
-        SendCommand(DATA_START_TRANSMISSION_1);
-        DelayMs(2);
-        for (int i = 0; i < this->width * this->height / 8; i++) {
-            temp = 0x00;
-            for (int bit = 0; bit < 4; bit++) {
-                if ((pgm_read_byte(&frame_buffer_black[i]) & (0x80 >> bit)) != 0) {
-                    temp |= 0xC0 >> (bit * 2);
-                }
-            }
-            SendData(temp);
-            temp = 0x00;
-            for (int bit = 4; bit < 8; bit++) {
-                if ((pgm_read_byte(&frame_buffer_black[i]) & (0x80 >> bit)) != 0) {
-                    temp |= 0xC0 >> ((bit - 4) * 2);
-                }
-            }
-            SendData(temp);
-        }
-        DelayMs(2);
-    }
-    if (frame_buffer_red != NULL) {
-        SendCommand(DATA_START_TRANSMISSION_2);
-        DelayMs(2);
-        for (int i = 0; i < this->width * this->height / 8; i++) {
-            SendData(pgm_read_byte(&frame_buffer_red[i]));
-        }
-        DelayMs(2);
-    }
-    SendCommand(DISPLAY_REFRESH);
-    WaitUntilIdle();
+void Epd1in54b::SetLutRed(void) {
+    LoadLut(LUT);
 }
 
 /**
@@ -202,7 +64,8 @@ void Epd::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned c
  *          executed if check code = 0xA5. 
  *          You can use Epd::Init() to awaken
  */
-void Epd::Sleep() {
+void Epd1in54b::Sleep() {
+    WaitUntilIdle();
     SendCommand(VCOM_AND_DATA_INTERVAL_SETTING);
     SendData(0x17);
     SendCommand(VCM_DC_SETTING_REGISTER);         //to solve Vcom drop
@@ -214,56 +77,79 @@ void Epd::Sleep() {
     SendData(0x00);
     WaitUntilIdle();
     SendCommand(POWER_OFF);         //power off
+    _state = EPD_SLEEPING;
 }
 
-const unsigned char lut_vcom0[] =
+const unsigned char Epd1in54bTraits::INIT[] =
 {
-    0x0E, 0x14, 0x01, 0x0A, 0x06, 0x04, 0x0A, 0x0A,
-    0x0F, 0x03, 0x03, 0x0C, 0x06, 0x0A, 0x00
+    POWER_SETTING,                   4, 0x07, 0x00, 0x08, 0x00,
+    BOOSTER_SOFT_START,              3, 0x07, 0x07, 0x07,
+    POWER_ON,                        EPD_SCRIPT_WAIT,
+    PANEL_SETTING,                   1, 0xcf,
+    VCOM_AND_DATA_INTERVAL_SETTING,  1, 0x17,
+    PLL_CONTROL,                     1, 0x39,
+    TCON_RESOLUTION,                 3, 0xC8, 0x00, 0xC8,
+    VCM_DC_SETTING_REGISTER,         1, 0x0E,
+    EPD_SCRIPT_END
 };
 
-const unsigned char lut_w[] =
+const unsigned char Epd1in54bTraits::LUT_BW[] =
 {
+    0x20, 15,   // g vcom
+    0x0E, 0x14, 0x01, 0x0A, 0x06, 0x04, 0x0A, 0x0A,
+    0x0F, 0x03, 0x03, 0x0C, 0x06, 0x0A, 0x00,
+    0x21, 15,   // g ww --
     0x0E, 0x14, 0x01, 0x0A, 0x46, 0x04, 0x8A, 0x4A,
-    0x0F, 0x83, 0x43, 0x0C, 0x86, 0x0A, 0x04
-};
-
-const unsigned char lut_b[] = 
-{
+    0x0F, 0x83, 0x43, 0x0C, 0x86, 0x0A, 0x04,
+    0x22, 15,   // g bw r
     0x0E, 0x14, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A,
-    0x0F, 0x83, 0x43, 0x0C, 0x06, 0x4A, 0x04
-};
-
-const unsigned char lut_g1[] = 
-{
+    0x0F, 0x83, 0x43, 0x0C, 0x06, 0x4A, 0x04,
+    0x23, 15,   // g wb w
     0x8E, 0x94, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A,
-    0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04
-};
-
-const unsigned char lut_g2[] = 
-{
+    0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04,
+    0x24, 15,   // g bb b
     0x8E, 0x94, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A,
-    0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04
+    0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04,
+    EPD_SCRIPT_END
 };
 
-const unsigned char lut_vcom1[] = 
+const unsigned char Epd1in54bTraits::LUT[] =
 {
+    0x25, 15,
     0x03, 0x1D, 0x01, 0x01, 0x08, 0x23, 0x37, 0x37,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 15,
+    0x83, 0x5D, 0x01, 0x81, 0x48, 0x23, 0x77, 0x77,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 15,
+    0x03, 0x1D, 0x01, 0x01, 0x08, 0x23, 0x37, 0x37,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    EPD_SCRIPT_END
 };
 
-const unsigned char lut_red0[] = 
+// no red stage
+const unsigned char Epd1in54bTraits::LUT_FAST[] =
 {
-    0x83, 0x5D, 0x01, 0x81, 0x48, 0x23, 0x77, 0x77,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    0x25, 15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    EPD_SCRIPT_END
 };
 
-const unsigned char lut_red1[] = 
+// register waveforms (LUT_BW, LUT) at the PLL of INIT at every temperature,
+// the bands only set the refresh estimate and where LUT_FAST is allowed
+const EpdTemperatureBand Epd1in54bTraits::TEMPERATURE_BANDS[] =
 {
-    0x03, 0x1D, 0x01, 0x01, 0x08, 0x23, 0x37, 0x37,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    // minimum PLL refreshMs fastMs
+    { -128, 0x00, 16000,    0 },
+    {    0, 0x00, 12000,    0 },
+    {   10, 0x00,  8000, 4000 },
 };
 
 /* END OF FILE */
-
-
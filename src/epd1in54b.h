@@ -27,75 +27,88 @@
 #ifndef EPD1IN54B_H
 #define EPD1IN54B_H
 
-#include "epdif.h"
+#include "epdpanel.h"
 
-// Display resolution
-#define EPD_WIDTH       200
-#define EPD_HEIGHT      200
+struct Epd1in54bTraits : EpdDefaultTiming {
+    // Display resolution
+    enum {
+        WIDTH                                     = 200,
+        HEIGHT                                    = 200,
+        RESOLUTION_IN_FRAME                       = false,
+        CLEAR_BLACK                               = 0xFF,
+        CLEAR_RED                                 = 0xFF,
+        FAST_BW                                   = true,
+        LUT_FROM_REGISTER                         = 0x00,
+        TEMPERATURE_BAND_COUNT                    = 3,
+    };
+    static const EPD_PIXEL_FORMAT  PIXEL_FORMAT   = EPD_2BPP_BLACK;
+    static const EPD_WINDOW_FORMAT WINDOW_FORMAT  = EPD_WINDOW_NONE;
 
-// EPD1IN54B commands
-#define PANEL_SETTING                               0x00
-#define POWER_SETTING                               0x01
-#define POWER_OFF                                   0x02
-#define POWER_OFF_SEQUENCE_SETTING                  0x03
-#define POWER_ON                                    0x04
-#define POWER_ON_MEASURE                            0x05
-#define BOOSTER_SOFT_START                          0x06
-#define DEEP_SLEEP                                  0x07
-#define DATA_START_TRANSMISSION_1                   0x10
-#define DATA_STOP                                   0x11
-#define DISPLAY_REFRESH                             0x12
-#define DATA_START_TRANSMISSION_2                   0x13
-#define PLL_CONTROL                                 0x30
-#define TEMPERATURE_SENSOR_COMMAND                  0x40
-#define TEMPERATURE_SENSOR_CALIBRATION              0x41
-#define TEMPERATURE_SENSOR_WRITE                    0x42
-#define TEMPERATURE_SENSOR_READ                     0x43
-#define VCOM_AND_DATA_INTERVAL_SETTING              0x50
-#define LOW_POWER_DETECTION                         0x51
-#define TCON_SETTING                                0x60
-#define TCON_RESOLUTION                             0x61
-#define SOURCE_AND_GATE_START_SETTING               0x62
-#define GET_STATUS                                  0x71
-#define AUTO_MEASURE_VCOM                           0x80
-#define VCOM_VALUE                                  0x81
-#define VCM_DC_SETTING_REGISTER                     0x82
-#define PROGRAM_MODE                                0xA0
-#define ACTIVE_PROGRAM                              0xA1
-#define READ_OTP_DATA                               0xA2
+    // EPD1IN54B commands
+    enum {
+        PANEL_SETTING                             = 0x00,
+        POWER_SETTING                             = 0x01,
+        POWER_OFF                                 = 0x02,
+        POWER_OFF_SEQUENCE_SETTING                = 0x03,
+        POWER_ON                                  = 0x04,
+        POWER_ON_MEASURE                          = 0x05,
+        BOOSTER_SOFT_START                        = 0x06,
+        DEEP_SLEEP                                = 0x07,
+        DATA_START_TRANSMISSION_1                 = 0x10,
+        DATA_STOP                                 = 0x11,
+        DISPLAY_REFRESH                           = 0x12,
+        DATA_START_TRANSMISSION_2                 = 0x13,
+        PLL_CONTROL                               = 0x30,
+        TEMPERATURE_SENSOR_COMMAND                = 0x40,
+        TEMPERATURE_SENSOR_CALIBRATION            = 0x41,
+        TEMPERATURE_SENSOR_WRITE                  = 0x42,
+        TEMPERATURE_SENSOR_READ                   = 0x43,
+        VCOM_AND_DATA_INTERVAL_SETTING            = 0x50,
+        LOW_POWER_DETECTION                       = 0x51,
+        TCON_SETTING                              = 0x60,
+        TCON_RESOLUTION                           = 0x61,
+        SOURCE_AND_GATE_START_SETTING             = 0x62,
+        GET_STATUS                                = 0x71,
+        AUTO_MEASURE_VCOM                         = 0x80,
+        VCOM_VALUE                                = 0x81,
+        VCM_DC_SETTING_REGISTER                   = 0x82,
+        PROGRAM_MODE                              = 0xA0,
+        ACTIVE_PROGRAM                            = 0xA1,
+        READ_OTP_DATA                             = 0xA2,
+    };
 
-extern const unsigned char lut_vcom0[];
-extern const unsigned char lut_vcom1[];
-extern const unsigned char lut_w[];
-extern const unsigned char lut_b[];
-extern const unsigned char lut_g1[];
-extern const unsigned char lut_g2[];
-extern const unsigned char lut_red0[];
-extern const unsigned char lut_red1[];
+    // scripts, see EPD_SCRIPT_END
+    static const unsigned char INIT[];
+    static const unsigned char LUT_BW[];
+    // red stage, tri-colour and skipped, LUT_BW goes along with either
+    static const unsigned char LUT[];
+    static const unsigned char LUT_FAST[];
+
+    // waveform settings by temperature, see Panel::SetTemperature()
+    static const EpdTemperatureBand TEMPERATURE_BANDS[];
+};
 
-class Epd : EpdIf {
+class Epd1in54b : public Panel<Epd1in54bTraits> {
 public:
-    unsigned long width;
-    unsigned long height;
+    Epd1in54b()
+        : Panel()
+    {}
+    Epd1in54b(SPIClass& hwSPI, int16_t pinCS, int16_t pinDC, int16_t pinReset, int16_t pinBusy)
+        : Panel(hwSPI, pinCS, pinDC, pinReset, pinBusy)
+    {}
 
-    Epd();
-    ~Epd();
-    int  Init(void);
-    void SendCommand(unsigned char command);
-    void SendData(unsigned char data);
-    void WaitUntilIdle(void);
-    void Reset(void);
+    bool Init(void);
     void SetLutBw(void);
     void SetLutRed(void);
-    void DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red);
     void Sleep(void);
-private:
-    unsigned int reset_pin;
-    unsigned int dc_pin;
-    unsigned int cs_pin;
-    unsigned int busy_pin;
 };
 
+#if !defined(EPD_MULTI_PANEL)
+typedef Epd1in54b Epd;
+#define EPD_WIDTH       200
+#define EPD_HEIGHT      200
+#endif
+
 #endif /* EPD1IN54B_H */
 
 /* END OF FILE */
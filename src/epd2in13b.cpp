@@ -27,224 +27,17 @@
 #include <stdlib.h>
 #include <epd2in13b.h>
 
-Epd::~Epd() {
-};
-
-Epd::Epd() {
-    reset_pin = RST_PIN;
-    dc_pin = DC_PIN;
-    cs_pin = CS_PIN;
-    busy_pin = BUSY_PIN;
-    width = EPD_WIDTH;
-    height = EPD_HEIGHT;
-};
-
-int Epd::Init(void) {
+bool Epd2in13b::Init(void) {
     /* this calls the peripheral hardware interface, see epdif */
-    if (IfInit() != 0) {
-        return -1;
+    if (!IfInit()) {
+        return false;
     }
     /* EPD hardware init start */
-    Reset();
-    SendCommand(BOOSTER_SOFT_START);
-    SendData(0x17);
-    SendData(0x17);
-    SendData(0x17);
-    SendCommand(POWER_ON);
-    WaitUntilIdle();
-    SendCommand(PANEL_SETTING);
-    SendData(0x8F);
-    SendCommand(VCOM_AND_DATA_INTERVAL_SETTING);
-    SendData(0x37);
-    SendCommand(RESOLUTION_SETTING);
-    SendData(0x68);     // width: 104
-    SendData(0x00);
-    SendData(0xD4);     // height: 212
+    Wake();
+    RunScript(INIT);
     /* EPD hardware init end */
-    return 0;
-
-}
-
-/**
- *  @brief: basic function for sending commands
- */
-void Epd::SendCommand(unsigned char command) {
-    DigitalWrite(dc_pin, LOW);
-    SpiTransfer(command);
-}
-
-/**
- *  @brief: basic function for sending data
- */
-void Epd::SendData(unsigned char data) {
-    DigitalWrite(dc_pin, HIGH);
-    SpiTransfer(data);
-}
-
-/**
- *  @brief: Wait until the busy_pin goes HIGH
- */
-void Epd::WaitUntilIdle(void) {
-    while(DigitalRead(busy_pin) == 0) {      //0: busy, 1: idle
-        DelayMs(100);
-    }      
-}
-
-/**
- *  @brief: module reset. 
- *          often used to awaken the module in deep sleep, 
- *          see Epd::Sleep();
- */
-void Epd::Reset(void) {
-    DigitalWrite(reset_pin, LOW);
-    DelayMs(200);
-    DigitalWrite(reset_pin, HIGH);
-    DelayMs(200);   
-}
-
-/**
- *  @brief: transmit partial data to the SRAM
- */
-void Epd::SetPartialWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int x, int y, int w, int l) {
-    SendCommand(PARTIAL_IN);
-    SendCommand(PARTIAL_WINDOW);
-    SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
-    SendData(((x & 0xf8) + w  - 1) | 0x07);
-    SendData(y >> 8);        
-    SendData(y & 0xff);
-    SendData((y + l - 1) >> 8);        
-    SendData((y + l - 1) & 0xff);
-    SendData(0x01);         // Gates scan both inside and outside of the partial window. (default) 
-    DelayMs(2);
-    SendCommand(DATA_START_TRANSMISSION_1);
-    if (buffer_black != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_black[i]);  
-        }  
-    } else {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(0x00);  
-        }  
-    }
-    DelayMs(2);
-    SendCommand(DATA_START_TRANSMISSION_2);
-    if (buffer_red != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_red[i]);  
-        }  
-    } else {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(0x00);  
-        }  
-    }
-    DelayMs(2);
-    SendCommand(PARTIAL_OUT);  
-}
+    return true;
 
-/**
- *  @brief: transmit partial data to the black part of SRAM
- */
-void Epd::SetPartialWindowBlack(const unsigned char* buffer_black, int x, int y, int w, int l) {
-    SendCommand(PARTIAL_IN);
-    SendCommand(PARTIAL_WINDOW);
-    SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
-    SendData(((x & 0xf8) + w  - 1) | 0x07);
-    SendData(y >> 8);        
-    SendData(y & 0xff);
-    SendData((y + l - 1) >> 8);        
-    SendData((y + l - 1) & 0xff);
-    SendData(0x01);         // Gates scan both inside and outside of the partial window. (default) 
-    DelayMs(2);
-    SendCommand(DATA_START_TRANSMISSION_1);
-    if (buffer_black != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_black[i]);  
-        }  
-    } else {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(0x00);  
-        }  
-    }
-    DelayMs(2);
-    SendCommand(PARTIAL_OUT);  
-}
-
-/**
- *  @brief: transmit partial data to the red part of SRAM
- */
-void Epd::SetPartialWindowRed(const unsigned char* buffer_red, int x, int y, int w, int l) {
-    SendCommand(PARTIAL_IN);
-    SendCommand(PARTIAL_WINDOW);
-    SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
-    SendData(((x & 0xf8) + w  - 1) | 0x07);
-    SendData(y >> 8);        
-    SendData(y & 0xff);
-    SendData((y + l - 1) >> 8);        
-    SendData((y + l - 1) & 0xff);
-    SendData(0x01);         // Gates scan both inside and outside of the partial window. (default) 
-    DelayMs(2);
-    SendCommand(DATA_START_TRANSMISSION_2);
-    if (buffer_red != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_red[i]);  
-        }  
-    } else {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(0x00);  
-        }  
-    }
-    DelayMs(2);
-    SendCommand(PARTIAL_OUT);  
-}
-
-/**
- * @brief: refresh and displays the frame
- */
-void Epd::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red) {
-    if (frame_buffer_black != NULL) {
-        SendCommand(DATA_START_TRANSMISSION_1);
-        DelayMs(2);
-        for (int i = 0; i < this->width * this->height / 8; i++) {
-            SendData(pgm_read_byte(&frame_buffer_black[i]));
-        }
-        DelayMs(2);
-    }
-    if (frame_buffer_red != NULL) {
-        SendCommand(DATA_START_TRANSMISSION_2);
-        DelayMs(2);
-        for (int i = 0; i < this->width * this->height / 8; i++) {
-            SendData(pgm_read_byte(&frame_buffer_red[i]));
-        }
-        DelayMs(2);
-    }
-    SendCommand(DISPLAY_REFRESH);
-    WaitUntilIdle();
-}
-
-/**
- * @brief: clear the frame data from the SRAM, this won't refresh the display
- */
-void Epd::ClearFrame(void) {
-    SendCommand(DATA_START_TRANSMISSION_1);           
-    DelayMs(2);
-    for(int i = 0; i < width * height / 8; i++) {
-        SendData(0xFF);  
-    }  
-    DelayMs(2);
-    SendCommand(DATA_START_TRANSMISSION_2);           
-    DelayMs(2);
-    for(int i = 0; i < width * height / 8; i++) {
-        SendData(0xFF);  
-    }  
-    DelayMs(2);
-}
-
-/**
- * @brief: This displays the frame data from SRAM
- */
-void Epd::DisplayFrame(void) {
-    SendCommand(DISPLAY_REFRESH); 
-    WaitUntilIdle();
 }
 
 /**
@@ -253,14 +46,34 @@ void Epd::DisplayFrame(void) {
  *         check code, the command would be executed if check code = 0xA5. 
  *         You can use Epd::Reset() to awaken and use Epd::Init() to initialize.
  */
-void Epd::Sleep() {
+void Epd2in13b::Sleep() {
+    WaitUntilIdle();
     SendCommand(POWER_OFF);
     WaitUntilIdle();
-    SendCommand(DEEP_SLEEP);
-    SendData(0xA5);     // check code
+    DeepSleep();
 }
 
+const unsigned char Epd2in13bTraits::INIT[] =
+{
+    BOOSTER_SOFT_START,              3, 0x17, 0x17, 0x17,
+    POWER_ON,                        EPD_SCRIPT_WAIT,
+    PANEL_SETTING,                   1, 0x8F,
+    VCOM_AND_DATA_INTERVAL_SETTING,  1, 0x37,
+    RESOLUTION_SETTING,              3,
+        0x68,                                   // width: 104
+        0x00,
+        0xD4,                                   // height: 212
+    EPD_SCRIPT_END
+};
 
-/* END OF FILE */
+// OTP waveforms compensate themselves, the bands only estimate the refresh
+const EpdTemperatureBand Epd2in13bTraits::TEMPERATURE_BANDS[] =
+{
+    // minimum PLL refreshMs fastMs
+    { -128, 0x00, 30000,    0 },
+    {    0, 0x00, 20000,    0 },
+    {   10, 0x00, 15000,    0 },
+};
 
+/* END OF FILE */
 
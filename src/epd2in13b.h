@@ -27,78 +27,91 @@
 #ifndef EPD2IN13B_H
 #define EPD2IN13B_H
 
-#include "epdif.h"
+#include "epdpanel.h"
 
-// Display resolution
-#define EPD_WIDTH       104
-#define EPD_HEIGHT      212
+struct Epd2in13bTraits : EpdDefaultTiming {
+    // Display resolution
+    enum {
+        WIDTH                                     = 104,
+        HEIGHT                                    = 212,
+        RESOLUTION_IN_FRAME                       = false,
+        CLEAR_BLACK                               = 0xFF,
+        CLEAR_RED                                 = 0xFF,
+        FAST_BW                                   = false,
+        TEMPERATURE_BAND_COUNT                    = 3,
+    };
+    static const EPD_PIXEL_FORMAT  PIXEL_FORMAT   = EPD_1BPP;
+    static const EPD_WINDOW_FORMAT WINDOW_FORMAT  = EPD_WINDOW_X8;
+
+    // EPD2IN13B commands
+    enum {
+        PANEL_SETTING                             = 0x00,
+        POWER_SETTING                             = 0x01,
+        POWER_OFF                                 = 0x02,
+        POWER_OFF_SEQUENCE_SETTING                = 0x03,
+        POWER_ON                                  = 0x04,
+        POWER_ON_MEASURE                          = 0x05,
+        BOOSTER_SOFT_START                        = 0x06,
+        DEEP_SLEEP                                = 0x07,
+        DATA_START_TRANSMISSION_1                 = 0x10,
+        DATA_STOP                                 = 0x11,
+        DISPLAY_REFRESH                           = 0x12,
+        DATA_START_TRANSMISSION_2                 = 0x13,
+        VCOM_LUT                                  = 0x20,
+        W2W_LUT                                   = 0x21,
+        B2W_LUT                                   = 0x22,
+        W2B_LUT                                   = 0x23,
+        B2B_LUT                                   = 0x24,
+        PLL_CONTROL                               = 0x30,
+        TEMPERATURE_SENSOR_CALIBRATION            = 0x40,
+        TEMPERATURE_SENSOR_COMMAND                = TEMPERATURE_SENSOR_CALIBRATION,
+        TEMPERATURE_SENSOR_SELECTION              = 0x41,
+        TEMPERATURE_SENSOR_WRITE                  = 0x42,
+        TEMPERATURE_SENSOR_READ                   = 0x43,
+        VCOM_AND_DATA_INTERVAL_SETTING            = 0x50,
+        LOW_POWER_DETECTION                       = 0x51,
+        TCON_SETTING                              = 0x60,
+        RESOLUTION_SETTING                        = 0x61,
+        TCON_RESOLUTION                           = RESOLUTION_SETTING,
+        GET_STATUS                                = 0x71,
+        AUTO_MEASURE_VCOM                         = 0x80,
+        READ_VCOM_VALUE                           = 0x81,
+        VCM_DC_SETTING                            = 0x82,
+        PARTIAL_WINDOW                            = 0x90,
+        PARTIAL_IN                                = 0x91,
+        PARTIAL_OUT                               = 0x92,
+        PROGRAM_MODE                              = 0xA0,
+        ACTIVE_PROGRAM                            = 0xA1,
+        READ_OTP_DATA                             = 0xA2,
+        POWER_SAVING                              = 0xE3,
+    };
 
-// EPD2IN13B commands
-#define PANEL_SETTING                               0x00
-#define POWER_SETTING                               0x01
-#define POWER_OFF                                   0x02
-#define POWER_OFF_SEQUENCE_SETTING                  0x03
-#define POWER_ON                                    0x04
-#define POWER_ON_MEASURE                            0x05
-#define BOOSTER_SOFT_START                          0x06
-#define DEEP_SLEEP                                  0x07
-#define DATA_START_TRANSMISSION_1                   0x10
-#define DATA_STOP                                   0x11
-#define DISPLAY_REFRESH                             0x12
-#define DATA_START_TRANSMISSION_2                   0x13
-#define VCOM_LUT                                    0x20
-#define W2W_LUT                                     0x21
-#define B2W_LUT                                     0x22
-#define W2B_LUT                                     0x23
-#define B2B_LUT                                     0x24
-#define PLL_CONTROL                                 0x30
-#define TEMPERATURE_SENSOR_CALIBRATION              0x40
-#define TEMPERATURE_SENSOR_SELECTION                0x41
-#define TEMPERATURE_SENSOR_WRITE                    0x42
-#define TEMPERATURE_SENSOR_READ                     0x43
-#define VCOM_AND_DATA_INTERVAL_SETTING              0x50
-#define LOW_POWER_DETECTION                         0x51
-#define TCON_SETTING                                0x60
-#define RESOLUTION_SETTING                          0x61
-#define GET_STATUS                                  0x71
-#define AUTO_MEASURE_VCOM                           0x80
-#define READ_VCOM_VALUE                             0x81
-#define VCM_DC_SETTING                              0x82
-#define PARTIAL_WINDOW                              0x90
-#define PARTIAL_IN                                  0x91
-#define PARTIAL_OUT                                 0x92
-#define PROGRAM_MODE                                0xA0
-#define ACTIVE_PROGRAM                              0xA1
-#define READ_OTP_DATA                               0xA2
-#define POWER_SAVING                                0xE3
+    // scripts, see EPD_SCRIPT_END
+    static const unsigned char INIT[];
+
+    // waveform settings by temperature, see Panel::SetTemperature()
+    static const EpdTemperatureBand TEMPERATURE_BANDS[];
+};
 
-class Epd : EpdIf {
+class Epd2in13b : public Panel<Epd2in13bTraits> {
 public:
-    int width;
-    int height;
+    Epd2in13b()
+        : Panel()
+    {}
+    Epd2in13b(SPIClass& hwSPI, int16_t pinCS, int16_t pinDC, int16_t pinReset, int16_t pinBusy)
+        : Panel(hwSPI, pinCS, pinDC, pinReset, pinBusy)
+    {}
 
-    Epd();
-    ~Epd();
-    int  Init(void);
-    void SendCommand(unsigned char command);
-    void SendData(unsigned char data);
-    void WaitUntilIdle(void);
-    void Reset(void);
-    void SetPartialWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int x, int y, int w, int l);
-    void SetPartialWindowBlack(const unsigned char* buffer_black, int x, int y, int w, int l);
-    void SetPartialWindowRed(const unsigned char* buffer_red, int x, int y, int w, int l);
-    void DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red);
-    void DisplayFrame(void);
-    void ClearFrame(void);
+    bool Init(void);
     void Sleep(void);
-
-private:
-    unsigned int reset_pin;
-    unsigned int dc_pin;
-    unsigned int cs_pin;
-    unsigned int busy_pin;
 };
 
+#if !defined(EPD_MULTI_PANEL)
+typedef Epd2in13b Epd;
+#define EPD_WIDTH       104
+#define EPD_HEIGHT      212
+#endif
+
 #endif /* EPD2IN13B_H */
 
 /* END OF FILE */
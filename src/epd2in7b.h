@@ -27,86 +27,108 @@
 #ifndef EPD2IN7B_H
 #define EPD2IN7B_H
 
-#include "epdif.h"
+#include "epdpanel.h"
 
-// Display resolution
-#define EPD_WIDTH       176
-#define EPD_HEIGHT      264
+struct Epd2in7bTraits : EpdDefaultTiming {
+    // Display resolution
+    enum {
+        WIDTH                                     = 176,
+        HEIGHT                                    = 264,
+        RESOLUTION_IN_FRAME                       = true,
+        CLEAR_BLACK                               = 0x00,
+        CLEAR_RED                                 = 0x00,
+        FAST_BW                                   = true,
+        LUT_FROM_REGISTER                         = 0x00,
+        TEMPERATURE_BAND_COUNT                    = 4,
+    };
+    static const EPD_PIXEL_FORMAT  PIXEL_FORMAT   = EPD_1BPP;
+    static const EPD_WINDOW_FORMAT WINDOW_FORMAT  = EPD_WINDOW_PARTIAL_DTM;
 
-// EPD2IN7B commands
-#define PANEL_SETTING                               0x00
-#define POWER_SETTING                               0x01
-#define POWER_OFF                                   0x02
-#define POWER_OFF_SEQUENCE_SETTING                  0x03
-#define POWER_ON                                    0x04
-#define POWER_ON_MEASURE                            0x05
-#define BOOSTER_SOFT_START                          0x06
-#define DEEP_SLEEP                                  0x07
-#define DATA_START_TRANSMISSION_1                   0x10
-#define DATA_STOP                                   0x11
-#define DISPLAY_REFRESH                             0x12
-#define DATA_START_TRANSMISSION_2                   0x13
-#define PARTIAL_DATA_START_TRANSMISSION_1           0x14 
-#define PARTIAL_DATA_START_TRANSMISSION_2           0x15 
-#define PARTIAL_DISPLAY_REFRESH                     0x16
-#define LUT_FOR_VCOM                                0x20 
-#define LUT_WHITE_TO_WHITE                          0x21
-#define LUT_BLACK_TO_WHITE                          0x22
-#define LUT_WHITE_TO_BLACK                          0x23
-#define LUT_BLACK_TO_BLACK                          0x24
-#define PLL_CONTROL                                 0x30
-#define TEMPERATURE_SENSOR_COMMAND                  0x40
-#define TEMPERATURE_SENSOR_CALIBRATION              0x41
-#define TEMPERATURE_SENSOR_WRITE                    0x42
-#define TEMPERATURE_SENSOR_READ                     0x43
-#define VCOM_AND_DATA_INTERVAL_SETTING              0x50
-#define LOW_POWER_DETECTION                         0x51
-#define TCON_SETTING                                0x60
-#define TCON_RESOLUTION                             0x61
-#define SOURCE_AND_GATE_START_SETTING               0x62
-#define GET_STATUS                                  0x71
-#define AUTO_MEASURE_VCOM                           0x80
-#define VCOM_VALUE                                  0x81
-#define VCM_DC_SETTING_REGISTER                     0x82
-#define PROGRAM_MODE                                0xA0
-#define ACTIVE_PROGRAM                              0xA1
-#define READ_OTP_DATA                               0xA2
+    // EPD2IN7B commands
+    enum {
+        PANEL_SETTING                             = 0x00,
+        POWER_SETTING                             = 0x01,
+        POWER_OFF                                 = 0x02,
+        POWER_OFF_SEQUENCE_SETTING                = 0x03,
+        POWER_ON                                  = 0x04,
+        POWER_ON_MEASURE                          = 0x05,
+        BOOSTER_SOFT_START                        = 0x06,
+        DEEP_SLEEP                                = 0x07,
+        DATA_START_TRANSMISSION_1                 = 0x10,
+        DATA_STOP                                 = 0x11,
+        DISPLAY_REFRESH                           = 0x12,
+        DATA_START_TRANSMISSION_2                 = 0x13,
+        PARTIAL_DATA_START_TRANSMISSION_1         = 0x14,
+        PARTIAL_DATA_START_TRANSMISSION_2         = 0x15,
+        PARTIAL_DISPLAY_REFRESH                   = 0x16,
+        LUT_FOR_VCOM                              = 0x20,
+        LUT_WHITE_TO_WHITE                        = 0x21,
+        LUT_BLACK_TO_WHITE                        = 0x22,
+        LUT_WHITE_TO_BLACK                        = 0x23,
+        LUT_BLACK_TO_BLACK                        = 0x24,
+        PLL_CONTROL                               = 0x30,
+        TEMPERATURE_SENSOR_COMMAND                = 0x40,
+        TEMPERATURE_SENSOR_CALIBRATION            = 0x41,
+        TEMPERATURE_SENSOR_WRITE                  = 0x42,
+        TEMPERATURE_SENSOR_READ                   = 0x43,
+        VCOM_AND_DATA_INTERVAL_SETTING            = 0x50,
+        LOW_POWER_DETECTION                       = 0x51,
+        TCON_SETTING                              = 0x60,
+        TCON_RESOLUTION                           = 0x61,
+        SOURCE_AND_GATE_START_SETTING             = 0x62,
+        GET_STATUS                                = 0x71,
+        AUTO_MEASURE_VCOM                         = 0x80,
+        VCOM_VALUE                                = 0x81,
+        VCM_DC_SETTING_REGISTER                   = 0x82,
+        PROGRAM_MODE                              = 0xA0,
+        ACTIVE_PROGRAM                            = 0xA1,
+        READ_OTP_DATA                             = 0xA2,
+    };
 
-extern const unsigned char lut_vcom_dc[];
-extern const unsigned char lut_ww[];
-extern const unsigned char lut_bw[];
-extern const unsigned char lut_bb[];
-extern const unsigned char lut_wb[];
+    // scripts, see EPD_SCRIPT_END
+    static const unsigned char INIT[];
+    static const unsigned char LUT[];
+    static const unsigned char LUT_FAST[];
+
+    // waveform settings by temperature, see Panel::SetTemperature()
+    static const EpdTemperatureBand TEMPERATURE_BANDS[];
+};
 
-class Epd : EpdIf {
+class Epd2in7b : public Panel<Epd2in7bTraits> {
 public:
-    unsigned int width;
-    unsigned int height;
+    Epd2in7b()
+        : Panel()
+    {}
+    Epd2in7b(SPIClass& hwSPI, int16_t pinCS, int16_t pinDC, int16_t pinReset, int16_t pinBusy)
+        : Panel(hwSPI, pinCS, pinDC, pinReset, pinBusy)
+    {}
 
-    Epd();
-    ~Epd();
-    int  Init(void);
-    void SendCommand(unsigned char command);
-    void SendData(unsigned char data);
-    void WaitUntilIdle(void);
-    void Reset(void);
+    bool Init(void);
     void SetLut(void);
-    void TransmitPartial(const unsigned char* buffer_black, const unsigned char* buffer_red, int x, int y, int w, int l);
-    void TransmitPartialBlack(const unsigned char* buffer_black, int x, int y, int w, int l);
-    void TransmitPartialRed(const unsigned char* buffer_red, int x, int y, int w, int l);
-    void RefreshPartial(int x, int y, int w, int l);
-    void DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red);
-    void DisplayFrame(void);
-    void ClearFrame(void);
+    bool RefreshPartial(int16_t x, int16_t y, int16_t w, int16_t l);
     void Sleep(void);
 
-private:
-    unsigned int reset_pin;
-    unsigned int dc_pin;
-    unsigned int cs_pin;
-    unsigned int busy_pin;
+    // the partial transmissions only send the planes given, see SetPartialWindow()
+    inline bool TransmitPartial(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t l) {
+        return SetPartialWindow(buffer_black, buffer_red, x, y, w, l, buffer_black != NULL, buffer_red != NULL);
+    }
+    inline bool TransmitPartialBlack(const unsigned char* buffer_black, int16_t x, int16_t y, int16_t w, int16_t l) {
+        return TransmitPartial(buffer_black, NULL, x, y, w, l);
+    }
+    inline bool TransmitPartialRed(const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t l) {
+        return TransmitPartial(NULL, buffer_red, x, y, w, l);
+    }
+    inline bool TransmitPartialAsync(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t l) {
+        return SetPartialWindowAsync(buffer_black, buffer_red, x, y, w, l, buffer_black != NULL, buffer_red != NULL);
+    }
 };
 
+#if !defined(EPD_MULTI_PANEL)
+typedef Epd2in7b Epd;
+#define EPD_WIDTH       176
+#define EPD_HEIGHT      264
+#endif
+
 #endif /* EPD2IN7B_H */
 
 /* END OF FILE */
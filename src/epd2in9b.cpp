@@ -28,7 +28,7 @@
 #include <stdlib.h>
 #include <epd2in9b.h>
 
-bool Epd::Init(void)
+bool Epd2in9b::Init(void)
 {
 /* this calls the peripheral hardware interface, see epdif */
   if (!IfInit())
@@ -36,277 +36,59 @@ bool Epd::Init(void)
     return false;
   }
   /* EPD hardware init start */
-  Reset();
-  SendCommand(BOOSTER_SOFT_START);
-  SendData(0x17, 3);
-  SendCommand(POWER_ON);
-  while(isBusy()) yield();
-  SendCommand(PANEL_SETTING);
-  //SendData(0x8F);
-  SendData(0x83 | _orientation);
-  SendCommand(VCOM_AND_DATA_INTERVAL_SETTING);
-  SendData(0x77);
-  SendCommand(TCON_RESOLUTION);
-  SendData(0x80);
-  SendData(0x01);
-  SendData(0x28);
-  //SendData((uint8_t)(_width & 0x00FF));
-  //SendData((uint8_t)(_height >> 8));
-  //SendData((uint8_t)(_height & 0x00FF) );
-  SendCommand(VCM_DC_SETTING_REGISTER);
-  SendData(0X0A);
+  Wake();
+  RunScript(POWER_UP);
+  //SendPanelSetting(0x8F);
+  SendPanelSetting(0x83 | _orientation);
+  RunScript(INIT);
   /* EPD hardware init end */
   return true;
 }
 
-bool Epd::Init(SCREEN_ORIENTATION Orientation) {
+bool Epd2in9b::Init(SCREEN_ORIENTATION Orientation) {
   _orientation = Orientation;
   return Init();
 }
 
 /**
- *  @brief: basic function for sending commands
- */
-void Epd::SendCommand(unsigned char command)
-{
-  DigitalWrite(_DC, LOW);
-  SpiTransfer(command, 1);
-}
-
-/**
-*  @brief: basic function for sending data
-*/
-void Epd::SendData(unsigned char data, int16_t len) {
-  DigitalWrite(_DC, HIGH);
-  SpiTransfer(data, len);
-}
-void Epd::SendData(const unsigned char *data, int16_t len) {
-  DigitalWrite(_DC, HIGH);
-  SpiTransfer(data, len);
-}
-
-/**
- *  @brief: Wait until the busy_pin goes HIGH
- */
-void Epd::WaitUntilIdle(void)
-{
-  while (isBusy()) DelayMs(100);
-}
-
-/**
- *  @brief: module reset.
- *          often used to awaken the module in deep sleep,
- *          see Epd::Sleep();
- */
-void Epd::Reset(void)
-{
-  DigitalWrite(_RST, LOW);
-  DelayMs(200);
-  DigitalWrite(_RST, HIGH);
-  DelayMs(200);
-}
-
-/**
- *  @brief: transmit partial data to the SRAM
- */
-bool Epd::SetPartialWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack, bool transmitRed) 
-{
-  if (isBusy()) return false;
-
-  SendCommand(PARTIAL_IN);
-  SendCommand(PARTIAL_WINDOW);
-  unsigned char dims[] =
-  { (x & 0xf8)    // x should be the multiple of 8, the last 3 bit will always be ignored
-  , (((x & 0xf8) + w - 1) | 0x07)
-  , (y >> 8)
-  , (y & 0xff)
-  , ((y + h - 1) >> 8)
-  , ((y + h - 1) & 0xff)
-  , (0x01)         // Gates scan both inside and outside of the partial window. (default) 
-  };
-  SendData(dims, sizeof(dims));
-  DelayMs(2);
-
-  if (transmitBlack) {
-    SendCommand(DATA_START_TRANSMISSION_1);
-    if (buffer_black != NULL) {
-      SendData(buffer_black, w / 8 * h);
-    }
-    else {
-      SendData((uint8_t)0x00, w / 8 * h);
-    }
-    DelayMs(2);
-  }
-
-  if (transmitRed) {
-    SendCommand(DATA_START_TRANSMISSION_2);
-    if (buffer_red != NULL) {
-      SendData(buffer_red, w / 8 * h);
-    }
-    else {
-      SendData((unsigned char)0x00, w / 8 * h);
-    }
-    DelayMs(2);
-  }
-  SendCommand(PARTIAL_OUT);
-  
-  return true;
-}
-
-/**
- *  @brief: transmit partial data to the black part of SRAM
- */
-bool Epd::SetPartialWindowBlack(const unsigned char* buffer_black, int16_t x, int16_t y, int16_t w, int16_t h)   
-{
-  return SetPartialWindow(buffer_black, NULL, x, y, w, h, true, false);
-}
-//{
-//  if (isBusy()) return false;
-//
-//  SendCommand(PARTIAL_IN);
-//  SendCommand(PARTIAL_WINDOW);
-//  unsigned char dims[] =
-//  { (x & 0xf8)    // x should be the multiple of 8, the last 3 bit will always be ignored
-//  , (((x & 0xf8) + w - 1) | 0x07)
-//  , (y >> 8)
-//  , (y & 0xff)
-//  , ((y + h - 1) >> 8)
-//  , ((y + h - 1) & 0xff)
-//  , (0x01)         // Gates scan both inside and outside of the partial window. (default) 
-//  };
-//  SendData(dims, sizeof(dims));
-//  DelayMs(2);
-//  SendCommand(DATA_START_TRANSMISSION_1);
-//  if (buffer_black != NULL)
-//  {
-//    SendData(buffer_black, w / 8 * h);
-//  }
-//  else
-//  {
-//    SendData((unsigned char)0x00, w / 8 * h);
-//  }
-//  DelayMs(2);
-//  SendCommand(PARTIAL_OUT);
-//}
-//
-
-/**
- *  @brief: transmit partial data to the red part of SRAM
+ * @brief: After this command is transmitted, the chip would enter the deep-sleep mode to save power.
+ *         The deep sleep mode would return to standby by hardware reset. The only one parameter is a
+ *         check code, the command would be executed if check code = 0xA5.
+ *         You can use Epd::Reset() to awaken and use Epd::Init() to initialize.
  */
-bool Epd::SetPartialWindowRed(const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h)
+void Epd2in9b::Sleep()
 {
-  return SetPartialWindow(NULL, buffer_red, x, y, w, h, false, true);
+  WaitUntilIdle();
+  DeepSleep();
 }
-//{
-//  if (isBusy()) return false;
-//
-//  SendCommand(PARTIAL_IN);
-//  SendCommand(PARTIAL_WINDOW);
-//  unsigned char dims[] =
-//  { (x & 0xf8)    // x should be the multiple of 8, the last 3 bit will always be ignored
-//  , (((x & 0xf8) + w - 1) | 0x07)
-//  , (y >> 8)
-//  , (y & 0xff)
-//  , ((y + h - 1) >> 8)
-//  , ((y + h - 1) & 0xff)
-//  , (0x01)         // Gates scan both inside and outside of the partial window. (default) 
-//  };
-//  SendData(dims, sizeof(dims));
-//  DelayMs(2);
-//  SendCommand(DATA_START_TRANSMISSION_2);
-//  if (buffer_red != NULL)
-//  {
-//    SendData(buffer_red, w / 8 * h);
-//  }
-//  else
-//  {
-//    SendData((unsigned char)0x00, w / 8 * h);
-//  }
-//  DelayMs(2);
-//  SendCommand(PARTIAL_OUT);
-//
-//  return true;
-//}
 
-/**
- * @brief: refresh and displays the frame
- */
-bool Epd::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red)
+const unsigned char Epd2in9bTraits::POWER_UP[] =
 {
-  if (isBusy()) return false;
+  BOOSTER_SOFT_START,              3, 0x17, 0x17, 0x17,
+  POWER_ON,                        EPD_SCRIPT_WAIT,
+  EPD_SCRIPT_END
+};
 
-  if (frame_buffer_black != NULL)
-  {
-    SendCommand(DATA_START_TRANSMISSION_1);
-    DelayMs(2);
-    SendData(frame_buffer_black, this->_width * this->_height / 8);
-    DelayMs(2);
-  }
-  if (frame_buffer_red != NULL)
-  {
-    SendCommand(DATA_START_TRANSMISSION_2);
-    DelayMs(2);
-    SendData(frame_buffer_red, this->_width * this->_height / 8);
-    DelayMs(2);
-  }
-  SendCommand(DISPLAY_REFRESH);
-  //WaitUntilIdle();
-  
-  return true;
-}
-
-/**
- * @brief: clear the frame data from the SRAM, this won't refresh the display
- */
-bool Epd::ClearFrame(void)
+const unsigned char Epd2in9bTraits::INIT[] =
 {
-  if (isBusy()) return false;
-
-  SendCommand(TCON_RESOLUTION);
-  unsigned char dims[] =
-  { (_width >>8)
-  , (_width & 0xff)
-  , (_height >> 8)
-  , (_height & 0xff)
-  };
-  SendData(dims, sizeof(dims));
-
-  SendCommand(DATA_START_TRANSMISSION_1);
-  DelayMs(2);
-  SendData((unsigned char)0xFF, _width * _height / 8);
-  DelayMs(2);
-  SendCommand(DATA_START_TRANSMISSION_2);
-  DelayMs(2);
-  SendData((unsigned char)0xFF, _width * _height / 8);
-  DelayMs(2);
+  VCOM_AND_DATA_INTERVAL_SETTING,  1, 0x77,
+  TCON_RESOLUTION,                 3, 0x80, 0x01, 0x28,
+  VCM_DC_SETTING_REGISTER,         1, 0x0A,
+  EPD_SCRIPT_END
+};
 
-  return true;
-}
-
-/**
- * @brief: This displays the frame data from SRAM
- */
-bool Epd::DisplayFrame(void)
+const unsigned char Epd2in9bTraits::LUT[] =
 {
-  if (isBusy()) return false;
-
-  SendCommand(DISPLAY_REFRESH);
-  //WaitUntilIdle();
-
-  return true;
-}
+  EPD_SCRIPT_END                                  // from OTP
+};
 
-/**
- * @brief: After this command is transmitted, the chip would enter the deep-sleep mode to save power.
- *         The deep sleep mode would return to standby by hardware reset. The only one parameter is a
- *         check code, the command would be executed if check code = 0xA5.
- *         You can use Epd::Reset() to awaken and use Epd::Init() to initialize.
- */
-void Epd::Sleep()
+// OTP waveforms compensate themselves, the bands only estimate the refresh
+const EpdTemperatureBand Epd2in9bTraits::TEMPERATURE_BANDS[] =
 {
-  SendCommand(DEEP_SLEEP);
-  SendData(0xa5);
-}
-
+  // minimum PLL refreshMs fastMs
+  { -128, 0x00, 30000,    0 },
+  {    0, 0x00, 20000,    0 },
+  {   10, 0x00, 15000, 4100 },
+};
 
 /* END OF FILE */
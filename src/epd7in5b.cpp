@@ -25,200 +25,202 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "epd7in5b.h"
 
-Epd::~Epd() {
-};
-
-Epd::Epd() {
-    reset_pin = RST_PIN;
-    dc_pin = DC_PIN;
-    cs_pin = CS_PIN;
-    busy_pin = BUSY_PIN;
-    width = EPD_WIDTH;
-    height = EPD_HEIGHT;
-};
-
-int Epd::Init(void) {
-    if (IfInit() != 0) {
-        return -1;
+bool Epd7in5b::Init(void) {
+    if (!IfInit()) {
+        return false;
     }
-    Reset();
-
-    SendCommand(POWER_SETTING); 
-    SendData(0x37);
-    SendData(0x00);
-
-    SendCommand(PANEL_SETTING);
-    SendData(0xCF);
-    SendData(0x08);
-    
-    SendCommand(BOOSTER_SOFT_START);
-    SendData(0xc7);     
-    SendData(0xcc);
-    SendData(0x28);
-
-    SendCommand(POWER_ON);
-    WaitUntilIdle();
-
-    SendCommand(PLL_CONTROL);
-    SendData(0x3c);        
-
-    SendCommand(TEMPERATURE_CALIBRATION);
-    SendData(0x00);
+    Wake();
+    RunScript(INIT);
 
-    SendCommand(VCOM_AND_DATA_INTERVAL_SETTING);
-    SendData(0x77);
-
-    SendCommand(TCON_SETTING);
-    SendData(0x22);
-
-    SendCommand(TCON_RESOLUTION);
-    SendData(0x02);     //source 640
-    SendData(0x80);
-    SendData(0x01);     //gate 384
-    SendData(0x80);
-
-    SendCommand(VCM_DC_SETTING);
-    SendData(0x1E);      //decide by LUT file
-
-    SendCommand(0xe5);           //FLASH MODE            
-    SendData(0x03);  
-
-    return 0;
+    return true;
 }
 
 /**
- *  @brief: basic function for sending commands
+ *  @brief: one packed 2bpp source byte (4 pixels, 11 white, 00 black,
+ *          else red) as the two 4bpp bytes of DATA_START_TRANSMISSION_1
  */
-void Epd::SendCommand(unsigned char command) {
-    DigitalWrite(dc_pin, LOW);
-    SpiTransfer(command);
-}
+static const unsigned char epd7in5b_pixels[256][2] = {
+    {0x00, 0x00}, {0x00, 0x04}, {0x00, 0x04}, {0x00, 0x03}, {0x00, 0x40}, {0x00, 0x44}, {0x00, 0x44}, {0x00, 0x43},
+    {0x00, 0x40}, {0x00, 0x44}, {0x00, 0x44}, {0x00, 0x43}, {0x00, 0x30}, {0x00, 0x34}, {0x00, 0x34}, {0x00, 0x33},
+    {0x04, 0x00}, {0x04, 0x04}, {0x04, 0x04}, {0x04, 0x03}, {0x04, 0x40}, {0x04, 0x44}, {0x04, 0x44}, {0x04, 0x43},
+    {0x04, 0x40}, {0x04, 0x44}, {0x04, 0x44}, {0x04, 0x43}, {0x04, 0x30}, {0x04, 0x34}, {0x04, 0x34}, {0x04, 0x33},
+    {0x04, 0x00}, {0x04, 0x04}, {0x04, 0x04}, {0x04, 0x03}, {0x04, 0x40}, {0x04, 0x44}, {0x04, 0x44}, {0x04, 0x43},
+    {0x04, 0x40}, {0x04, 0x44}, {0x04, 0x44}, {0x04, 0x43}, {0x04, 0x30}, {0x04, 0x34}, {0x04, 0x34}, {0x04, 0x33},
+    {0x03, 0x00}, {0x03, 0x04}, {0x03, 0x04}, {0x03, 0x03}, {0x03, 0x40}, {0x03, 0x44}, {0x03, 0x44}, {0x03, 0x43},
+    {0x03, 0x40}, {0x03, 0x44}, {0x03, 0x44}, {0x03, 0x43}, {0x03, 0x30}, {0x03, 0x34}, {0x03, 0x34}, {0x03, 0x33},
+    {0x40, 0x00}, {0x40, 0x04}, {0x40, 0x04}, {0x40, 0x03}, {0x40, 0x40}, {0x40, 0x44}, {0x40, 0x44}, {0x40, 0x43},
+    {0x40, 0x40}, {0x40, 0x44}, {0x40, 0x44}, {0x40, 0x43}, {0x40, 0x30}, {0x40, 0x34}, {0x40, 0x34}, {0x40, 0x33},
+    {0x44, 0x00}, {0x44, 0x04}, {0x44, 0x04}, {0x44, 0x03}, {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43},
+    {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43}, {0x44, 0x30}, {0x44, 0x34}, {0x44, 0x34}, {0x44, 0x33},
+    {0x44, 0x00}, {0x44, 0x04}, {0x44, 0x04}, {0x44, 0x03}, {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43},
+    {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43}, {0x44, 0x30}, {0x44, 0x34}, {0x44, 0x34}, {0x44, 0x33},
+    {0x43, 0x00}, {0x43, 0x04}, {0x43, 0x04}, {0x43, 0x03}, {0x43, 0x40}, {0x43, 0x44}, {0x43, 0x44}, {0x43, 0x43},
+    {0x43, 0x40}, {0x43, 0x44}, {0x43, 0x44}, {0x43, 0x43}, {0x43, 0x30}, {0x43, 0x34}, {0x43, 0x34}, {0x43, 0x33},
+    {0x40, 0x00}, {0x40, 0x04}, {0x40, 0x04}, {0x40, 0x03}, {0x40, 0x40}, {0x40, 0x44}, {0x40, 0x44}, {0x40, 0x43},
+    {0x40, 0x40}, {0x40, 0x44}, {0x40, 0x44}, {0x40, 0x43}, {0x40, 0x30}, {0x40, 0x34}, {0x40, 0x34}, {0x40, 0x33},
+    {0x44, 0x00}, {0x44, 0x04}, {0x44, 0x04}, {0x44, 0x03}, {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43},
+    {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43}, {0x44, 0x30}, {0x44, 0x34}, {0x44, 0x34}, {0x44, 0x33},
+    {0x44, 0x00}, {0x44, 0x04}, {0x44, 0x04}, {0x44, 0x03}, {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43},
+    {0x44, 0x40}, {0x44, 0x44}, {0x44, 0x44}, {0x44, 0x43}, {0x44, 0x30}, {0x44, 0x34}, {0x44, 0x34}, {0x44, 0x33},
+    {0x43, 0x00}, {0x43, 0x04}, {0x43, 0x04}, {0x43, 0x03}, {0x43, 0x40}, {0x43, 0x44}, {0x43, 0x44}, {0x43, 0x43},
+    {0x43, 0x40}, {0x43, 0x44}, {0x43, 0x44}, {0x43, 0x43}, {0x43, 0x30}, {0x43, 0x34}, {0x43, 0x34}, {0x43, 0x33},
+    {0x30, 0x00}, {0x30, 0x04}, {0x30, 0x04}, {0x30, 0x03}, {0x30, 0x40}, {0x30, 0x44}, {0x30, 0x44}, {0x30, 0x43},
+    {0x30, 0x40}, {0x30, 0x44}, {0x30, 0x44}, {0x30, 0x43}, {0x30, 0x30}, {0x30, 0x34}, {0x30, 0x34}, {0x30, 0x33},
+    {0x34, 0x00}, {0x34, 0x04}, {0x34, 0x04}, {0x34, 0x03}, {0x34, 0x40}, {0x34, 0x44}, {0x34, 0x44}, {0x34, 0x43},
+    {0x34, 0x40}, {0x34, 0x44}, {0x34, 0x44}, {0x34, 0x43}, {0x34, 0x30}, {0x34, 0x34}, {0x34, 0x34}, {0x34, 0x33},
+    {0x34, 0x00}, {0x34, 0x04}, {0x34, 0x04}, {0x34, 0x03}, {0x34, 0x40}, {0x34, 0x44}, {0x34, 0x44}, {0x34, 0x43},
+    {0x34, 0x40}, {0x34, 0x44}, {0x34, 0x44}, {0x34, 0x43}, {0x34, 0x30}, {0x34, 0x34}, {0x34, 0x34}, {0x34, 0x33},
+    {0x33, 0x00}, {0x33, 0x04}, {0x33, 0x04}, {0x33, 0x03}, {0x33, 0x40}, {0x33, 0x44}, {0x33, 0x44}, {0x33, 0x43},
+    {0x33, 0x40}, {0x33, 0x44}, {0x33, 0x44}, {0x33, 0x43}, {0x33, 0x30}, {0x33, 0x34}, {0x33, 0x34}, {0x33, 0x33},
+};
 
 /**
- *  @brief: basic function for sending data
+ *  @brief: two pixels of a black and a red 1bpp plane, indexed by
+ *          black bits << 2 | red bits, as one 4bpp byte.
+ *          A cleared bit is coloured, red wins over black.
  */
-void Epd::SendData(unsigned char data) {
-    DigitalWrite(dc_pin, HIGH);
-    SpiTransfer(data);
-}
+static const unsigned char epd7in5b_planes[16] = {
+    0x44, 0x40, 0x04, 0x00, 0x44, 0x43, 0x04, 0x03,
+    0x44, 0x40, 0x34, 0x30, 0x44, 0x43, 0x34, 0x33
+};
 
 /**
- *  @brief: Wait until the busy_pin goes HIGH
+ *  @brief: converts packed 2bpp source pixels (4 per byte) into the 4bpp
+ *          format of DATA_START_TRANSMISSION_1, dst receives 2 * len bytes
  */
-void Epd::WaitUntilIdle(void) {
-    while(DigitalRead(busy_pin) == 0) {      //0: busy, 1: idle
-        DelayMs(100);
-    }      
+void Epd7in5b::ConvertPixels(const unsigned char* src, unsigned char* dst, int len) {
+    for (int i = 0; i < len; i++) {
+        const unsigned char* out = epd7in5b_pixels[pgm_read_byte(src + i)];
+        *dst++ = out[0];
+        *dst++ = out[1];
+    }
 }
 
 /**
- *  @brief: module reset.
- *          often used to awaken the module in deep sleep,
- *          see Epd::Sleep();
+ *  @brief: converts len bytes of a black and a red 1bpp plane into the
+ *          4bpp format, dst receives 4 * len bytes. A NULL plane has no
+ *          coloured pixels.
  */
-void Epd::Reset(void) {
-    DigitalWrite(reset_pin, LOW);                //module reset    
-    DelayMs(200);
-    DigitalWrite(reset_pin, HIGH);
-    DelayMs(200);    
+void Epd7in5b::ConvertPlanes(const unsigned char* black, const unsigned char* red, unsigned char* dst, int len) {
+    for (int i = 0; i < len; i++) {
+        unsigned char b = black != NULL ? pgm_read_byte(black + i) : 0xFF;
+        unsigned char r = red != NULL ? pgm_read_byte(red + i) : 0xFF;
+        for (int shift = 6; shift >= 0; shift -= 2) {
+            *dst++ = epd7in5b_planes[((b >> shift) & 0x03) << 2 | ((r >> shift) & 0x03)];
+        }
+    }
 }
 
-void Epd::DisplayFrame(const unsigned char** image_data) {
-    unsigned char temp1, temp2;
+bool Epd7in5b::DisplayFrame(const unsigned char** image_data) {
+    unsigned char row[WIDTH / 2];
+    WaitUntilIdle();
     SendCommand(DATA_START_TRANSMISSION_1);
 /**  
   * Size of a single array cannot be larger than 32K in AVR GCC, therefore 
   * you have to split the image data (61440 bytes in total) into 2 parts 
   */
     for (int image_data_part = 0; image_data_part < 2; image_data_part++) {
-        for (long i = 0; i < 30720; i++) {   
-            temp1 = pgm_read_byte(image_data[image_data_part] + i);
-            for (unsigned char j = 0; j < 4; j++) {
-                if ((temp1 & 0xC0) == 0xC0) {
-                    temp2 = 0x03;                       // white
-                } else if ((temp1 & 0xC0) == 0x00) {
-                    temp2 = 0x00;                       // black
-                } else {
-                    temp2 = 0x04;                       // red
-                }
-                temp2 <<= 4;
-                temp1 <<= 2;
-                j++;
-                if((temp1 & 0xC0) == 0xC0) {
-                    temp2 |= 0x03;                      // white
-                } else if ((temp1 & 0xC0) == 0x00) {
-                    temp2 |= 0x00;                      // black
-                } else {
-                    temp2 |= 0x04;                      // red
-                }
-                temp1 <<= 2;
-                SendData(temp2); 
-            }
+        for (long i = 0; i < 30720; i += WIDTH / 4) {
+            ConvertPixels(image_data[image_data_part] + i, row, WIDTH / 4);
+            SendData(row, sizeof(row));
         }
     }
+    SelectWaveform();
     SendCommand(DISPLAY_REFRESH);
-    DelayMs(100);
-    WaitUntilIdle();
+    BeginRefresh();
+    return true;
 }
 
-void Epd::Clean(void) {
+/**
+ *  @brief: displays a frame given as a black and a red 1bpp plane of
+ *          WIDTH * HEIGHT / 8 bytes each, as drawn by Paint with
+ *          COLORED = 0. Either plane can be NULL.
+ */
+bool Epd7in5b::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red) {
+    unsigned char row[WIDTH / 2];
+    WaitUntilIdle();
     SendCommand(DATA_START_TRANSMISSION_1);
-    for (long i = 0; i < 122880; i++) {    
-        SendData(0x33); 
+    for (long i = 0; i < (long)WIDTH / 8 * HEIGHT; i += WIDTH / 8) {
+        ConvertPlanes(frame_buffer_black != NULL ? frame_buffer_black + i : NULL,
+                      frame_buffer_red != NULL ? frame_buffer_red + i : NULL, row, WIDTH / 8);
+        SendData(row, sizeof(row));
     }
+    SelectWaveform();
     SendCommand(DISPLAY_REFRESH);
-    DelayMs(100);
-    WaitUntilIdle();
+    BeginRefresh();
+    return true;
 }
 
-void Epd::DisplayOneQuarterFrame(const unsigned char* image_data) {
-    unsigned char temp1, temp2;
+/**
+ *  @brief: banded rendering as in Panel::DisplayFrame(DisplayList&...),
+ *          band is split in half for the black and the red rows since
+ *          both planes go into the one 4bpp plane together
+ */
+bool Epd7in5b::DisplayFrame(DisplayList& black, DisplayList& red, unsigned char* band, int32_t band_bytes) {
+    const int16_t stride = WIDTH / 8;
+    unsigned char row[WIDTH / 2];
+    int32_t rows = band_bytes / 2 / stride;
+
+    if (rows < 1) return false;
+    if (rows > HEIGHT) rows = HEIGHT;
+
+    Paint paintBlack(band, WIDTH, HEIGHT, black.GetRotate(), black.isInverse());
+    Paint paintRed(band + rows * stride, WIDTH, HEIGHT, red.GetRotate(), red.isInverse());
+
+    WaitUntilIdle();
     SendCommand(DATA_START_TRANSMISSION_1);
+    for (int16_t top = 0; top < HEIGHT; top += rows) {
+        int16_t n = HEIGHT - top < rows ? HEIGHT - top : rows;
 
+        paintBlack.SetBand(top, n);
+        paintRed.SetBand(top, n);
+        memset(band, 0xFF, 2 * rows * stride);
+        black.Replay(paintBlack);
+        red.Replay(paintRed);
+        for (int16_t y = 0; y < n; y++) {
+            ConvertPlanes(band + y * stride, band + (rows + y) * stride, row, stride);
+            SendData(row, sizeof(row));
+        }
+    }
+    SelectWaveform();
+    SendCommand(DISPLAY_REFRESH);
+    BeginRefresh();
+    return true;
+}
 
-	for (long i = 0; i < 192; i++) {   
-			for (long k = 0; k < 80; k++) {
-				temp1 = pgm_read_byte(image_data + i*80 + k);
-				for (unsigned char j = 0; j < 4; j++) {
-					if ((temp1 & 0xC0) == 0xC0) {
-						temp2 = 0x03;                       // white
-					} else if ((temp1 & 0xC0) == 0x00) {
-						temp2 = 0x00;                       // black
-					} else {
-						temp2 = 0x04;                       // red
-					}
-					temp2 <<= 4;
-					temp1 <<= 2;
-					j++;
-					if((temp1 & 0xC0) == 0xC0) {
-						temp2 |= 0x03;                      // white
-					} else if ((temp1 & 0xC0) == 0x00) {
-						temp2 |= 0x00;                      // black
-					} else {
-						temp2 |= 0x04;                      // red
-					}
-					temp1 <<= 2;
-					SendData(temp2); 
-				}
-			}
-			for (long k = 0; k < 160; k++) {                // 1/4 show white
-				SendData(0x33); 
-			}
-		
-	}
-	for (long i = 0; i < 192; i++) {                    
-			for (long k = 0; k < 160; k++) {                 // 1/4 show red 
-				SendData(0x44); 
-			}
-			for (long k = 0; k < 160; k++) {                 // 1/4 show black 
-				SendData(0x00); 
-			}
-	}
+bool Epd7in5b::Clean(void) {
+    WaitUntilIdle();
+    SendCommand(DATA_START_TRANSMISSION_1);
+    for (long i = 0; i < HEIGHT; i++) {
+        SendData((unsigned char)0x33, WIDTH / 2);
+    }
+    SelectWaveform();
     SendCommand(DISPLAY_REFRESH);
-    DelayMs(100);
+    BeginRefresh();
+    return true;
+}
+
+bool Epd7in5b::DisplayOneQuarterFrame(const unsigned char* image_data) {
+    unsigned char row[WIDTH / 4];
     WaitUntilIdle();
+    SendCommand(DATA_START_TRANSMISSION_1);
+
+    for (long i = 0; i < 192; i++) {
+        ConvertPixels(image_data + i*80, row, 80);
+        SendData(row, sizeof(row));
+        SendData((unsigned char)0x33, 160);             // 1/4 show white
+    }
+    for (long i = 0; i < 192; i++) {
+        SendData((unsigned char)0x44, 160);             // 1/4 show red
+        SendData((unsigned char)0x00, 160);             // 1/4 show black
+    }
+    SelectWaveform();
+    SendCommand(DISPLAY_REFRESH);
+    BeginRefresh();
+    return true;
 }
 
 /**
@@ -229,13 +231,42 @@ void Epd::DisplayOneQuarterFrame(const unsigned char* image_data) {
  *          executed if check code = 0xA5. 
  *          You can use EPD_Reset() to awaken
  */
-void Epd::Sleep(void) {
+void Epd7in5b::Sleep(void) {
+    WaitUntilIdle();
     SendCommand(POWER_OFF);
     WaitUntilIdle();
-    SendCommand(DEEP_SLEEP);
-    SendData(0xa5);
+    DeepSleep();
 }
 
+const unsigned char Epd7in5bTraits::INIT[] =
+{
+    POWER_SETTING,                   2, 0x37, 0x00,
+    PANEL_SETTING,                   2, 0xCF, 0x08,
+    BOOSTER_SOFT_START,              3, 0xc7, 0xcc, 0x28,
+    POWER_ON,                        EPD_SCRIPT_WAIT,
+    PLL_CONTROL,                     1, 0x3c,
+    TEMPERATURE_CALIBRATION,         1, 0x00,
+    VCOM_AND_DATA_INTERVAL_SETTING,  1, 0x77,
+    TCON_SETTING,                    1, 0x22,
+    TCON_RESOLUTION,                 4,
+        0x02,                                   //source 640
+        0x80,
+        0x01,                                   //gate 384
+        0x80,
+    VCM_DC_SETTING,                  1, 0x1E,   //decide by LUT file
+    0xe5,                            1, 0x03,   //FLASH MODE
+    EPD_SCRIPT_END
+};
+
+// OTP waveforms compensate themselves, the bands only estimate the refresh
+const EpdTemperatureBand Epd7in5bTraits::TEMPERATURE_BANDS[] =
+{
+    // minimum PLL refreshMs fastMs
+    { -128, 0x00, 60000,    0 },
+    {    0, 0x00, 45000,    0 },
+    {   10, 0x00, 31000,    0 },
+};
+
 /* END OF FILE */
 
 
@@ -27,74 +27,100 @@
 #ifndef EPD7IN5B_H
 #define EPD7IN5B_H
 
-#include "epdif.h"
+#include "epdpanel.h"
 
-// Display resolution
-#define EPD_WIDTH       640
-#define EPD_HEIGHT      384
+struct Epd7in5bTraits : EpdDefaultTiming {
+    // Display resolution
+    enum {
+        WIDTH                                     = 640,
+        HEIGHT                                    = 384,
+        RESOLUTION_IN_FRAME                       = false,
+        CLEAR_BLACK                               = 0x33,
+        CLEAR_RED                                 = 0x33,
+        FAST_BW                                   = false,
+        TEMPERATURE_BAND_COUNT                    = 3,
+    };
+    static const EPD_PIXEL_FORMAT  PIXEL_FORMAT   = EPD_4BPP;
+    static const EPD_WINDOW_FORMAT WINDOW_FORMAT  = EPD_WINDOW_NONE;
+
+    // EPD7IN5B commands
+    enum {
+        PANEL_SETTING                             = 0x00,
+        POWER_SETTING                             = 0x01,
+        POWER_OFF                                 = 0x02,
+        POWER_OFF_SEQUENCE_SETTING                = 0x03,
+        POWER_ON                                  = 0x04,
+        POWER_ON_MEASURE                          = 0x05,
+        BOOSTER_SOFT_START                        = 0x06,
+        DEEP_SLEEP                                = 0x07,
+        DATA_START_TRANSMISSION_1                 = 0x10,
+        DATA_STOP                                 = 0x11,
+        DISPLAY_REFRESH                           = 0x12,
+        IMAGE_PROCESS                             = 0x13,
+        LUT_FOR_VCOM                              = 0x20,
+        LUT_BLUE                                  = 0x21,
+        LUT_WHITE                                 = 0x22,
+        LUT_GRAY_1                                = 0x23,
+        LUT_GRAY_2                                = 0x24,
+        LUT_RED_0                                 = 0x25,
+        LUT_RED_1                                 = 0x26,
+        LUT_RED_2                                 = 0x27,
+        LUT_RED_3                                 = 0x28,
+        LUT_XON                                   = 0x29,
+        PLL_CONTROL                               = 0x30,
+        TEMPERATURE_SENSOR_COMMAND                = 0x40,
+        TEMPERATURE_CALIBRATION                   = 0x41,
+        TEMPERATURE_SENSOR_WRITE                  = 0x42,
+        TEMPERATURE_SENSOR_READ                   = 0x43,
+        VCOM_AND_DATA_INTERVAL_SETTING            = 0x50,
+        LOW_POWER_DETECTION                       = 0x51,
+        TCON_SETTING                              = 0x60,
+        TCON_RESOLUTION                           = 0x61,
+        SPI_FLASH_CONTROL                         = 0x65,
+        REVISION                                  = 0x70,
+        GET_STATUS                                = 0x71,
+        AUTO_MEASUREMENT_VCOM                     = 0x80,
+        READ_VCOM_VALUE                           = 0x81,
+        VCM_DC_SETTING                            = 0x82,
+    };
 
-// EPD7IN5B commands
-#define PANEL_SETTING                               0x00
-#define POWER_SETTING                               0x01
-#define POWER_OFF                                   0x02
-#define POWER_OFF_SEQUENCE_SETTING                  0x03
-#define POWER_ON                                    0x04
-#define POWER_ON_MEASURE                            0x05
-#define BOOSTER_SOFT_START                          0x06
-#define DEEP_SLEEP                                  0x07
-#define DATA_START_TRANSMISSION_1                   0x10
-#define DATA_STOP                                   0x11
-#define DISPLAY_REFRESH                             0x12
-#define IMAGE_PROCESS                               0x13
-#define LUT_FOR_VCOM                                0x20 
-#define LUT_BLUE                                    0x21
-#define LUT_WHITE                                   0x22
-#define LUT_GRAY_1                                  0x23
-#define LUT_GRAY_2                                  0x24
-#define LUT_RED_0                                   0x25
-#define LUT_RED_1                                   0x26
-#define LUT_RED_2                                   0x27
-#define LUT_RED_3                                   0x28
-#define LUT_XON                                     0x29
-#define PLL_CONTROL                                 0x30
-#define TEMPERATURE_SENSOR_COMMAND                  0x40
-#define TEMPERATURE_CALIBRATION                     0x41
-#define TEMPERATURE_SENSOR_WRITE                    0x42
-#define TEMPERATURE_SENSOR_READ                     0x43
-#define VCOM_AND_DATA_INTERVAL_SETTING              0x50
-#define LOW_POWER_DETECTION                         0x51
-#define TCON_SETTING                                0x60
-#define TCON_RESOLUTION                             0x61
-#define SPI_FLASH_CONTROL                           0x65
-#define REVISION                                    0x70
-#define GET_STATUS                                  0x71
-#define AUTO_MEASUREMENT_VCOM                       0x80
-#define READ_VCOM_VALUE                             0x81
-#define VCM_DC_SETTING                              0x82
+    // scripts, see EPD_SCRIPT_END
+    static const unsigned char INIT[];
+
+    // waveform settings by temperature, see Panel::SetTemperature()
+    static const EpdTemperatureBand TEMPERATURE_BANDS[];
+};
 
-class Epd : EpdIf {
+class Epd7in5b : public Panel<Epd7in5bTraits> {
 public:
-    unsigned long width;
-    unsigned long height;
+    Epd7in5b()
+        : Panel()
+    {}
+    Epd7in5b(SPIClass& hwSPI, int16_t pinCS, int16_t pinDC, int16_t pinReset, int16_t pinBusy)
+        : Panel(hwSPI, pinCS, pinDC, pinReset, pinBusy)
+    {}
 
-    Epd();
-    ~Epd();
-    int  Init(void);
-    void WaitUntilIdle(void);
-    void Reset(void);
-    void DisplayFrame(const unsigned char** image_data);
-	void DisplayOneQuarterFrame(const unsigned char* image_data);
-	void Epd::Clean(void);
-    void SendCommand(unsigned char command);
-    void SendData(unsigned char data);
+    bool Init(void);
+    bool DisplayFrame(const unsigned char** image_data);
+    bool DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red);
+    bool DisplayFrame(DisplayList& black, DisplayList& red, unsigned char* band, int32_t band_bytes);
+    bool DisplayOneQuarterFrame(const unsigned char* image_data);
+    bool Clean(void);
     void Sleep(void);
+
+    inline bool DisplayFrame(void) { return Panel::DisplayFrame(); }
+
 private:
-    unsigned int reset_pin;
-    unsigned int dc_pin;
-    unsigned int cs_pin;
-    unsigned int busy_pin;
+    static void ConvertPixels(const unsigned char* src, unsigned char* dst, int len);
+    static void ConvertPlanes(const unsigned char* black, const unsigned char* red, unsigned char* dst, int len);
 };
 
+#if !defined(EPD_MULTI_PANEL)
+typedef Epd7in5b Epd;
+#define EPD_WIDTH       640
+#define EPD_HEIGHT      384
+#endif
+
 #endif /* EPD7IN5B_H */
 
 /* END OF FILE */
@@ -0,0 +1,78 @@
+/**
+ *  @filename   :   epddiff.cpp
+ *  @brief      :   Plane against shadow comparison, see epddiff.h
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <string.h>
+#include "epddiff.h"
+
+// unaligned 32 bit load, compiles to a single load where the core allows it
+static inline uint32_t LoadWord(const unsigned char* p)
+{
+  uint32_t word;
+  memcpy(&word, p, sizeof(word));
+  return word;
+}
+
+/**
+ *  @brief: index of the first byte that differs, -1 if none does
+ */
+static int16_t FirstDiff(const unsigned char* a, const unsigned char* b, int16_t len)
+{
+  int16_t i = 0;
+
+  for (; i + 4 <= len; i += 4) {
+    if (LoadWord(a + i) ^ LoadWord(b + i)) break;
+  }
+  for (; i < len; i++) {
+    if (a[i] != b[i]) return i;
+  }
+  return -1;
+}
+
+/**
+ *  @brief: index of the last byte that differs, one is known at first
+ */
+static int16_t LastDiff(const unsigned char* a, const unsigned char* b, int16_t len, int16_t first)
+{
+  int16_t i = len;
+
+  for (; i - 4 > first; i -= 4) {
+    if (LoadWord(a + i - 4) ^ LoadWord(b + i - 4)) break;
+  }
+  for (i--; i > first; i--) {
+    if (a[i] != b[i]) return i;
+  }
+  return first;
+}
+
+bool EpdDiffPlane(const unsigned char* image, const unsigned char* shadow, int16_t stride, int16_t height, PaintRegion& changes)
+{
+  changes.Clear();
+
+  for (int16_t y = 0; y < height; y++, image += stride, shadow += stride) {
+    int16_t first = FirstDiff(image, shadow, stride);
+    if (first < 0) continue;
+    int16_t last = LastDiff(image, shadow, stride, first);
+    changes.Add(first * 8, y, last * 8 + 7, y);
+  }
+  return changes.GetCount() > 0;
+}
+
+void EpdCopyWindow(unsigned char* shadow, int16_t stride, int16_t x, int16_t y, int16_t w, int16_t h, const unsigned char* image, int16_t image_stride, unsigned char fill)
+{
+  shadow += y * stride + x / 8;
+  for (; h > 0; h--, shadow += stride) {
+    if (image != NULL) {
+      memcpy(shadow, image, w / 8);
+      image += image_stride;
+    }
+    else {
+      memset(shadow, fill, w / 8);
+    }
+  }
+}
+
+/* END OF FILE */
@@ -0,0 +1,30 @@
+/**
+ *  @filename   :   epddiff.h
+ *  @brief      :   Compares a plane against a shadow copy of what the panel
+ *                  SRAM holds, see Panel::SetShadow()
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDDIFF_H
+#define EPDDIFF_H
+
+#include "epdpaint.h"
+
+/**
+ *  Compares height rows of stride bytes 32 bits at a time and collects
+ *  the changed bytes of each row in changes, where rows are merged into
+ *  byte aligned rectangles. Returns false if nothing changed.
+ */
+bool EpdDiffPlane(const unsigned char* image, const unsigned char* shadow, int16_t stride, int16_t height, PaintRegion& changes);
+
+/**
+ *  Copies window data with rows of image_stride bytes into the w x h
+ *  window at x, y (x and w multiples of 8) of a shadow with rows of
+ *  stride bytes. image == NULL fills the window with fill.
+ */
+void EpdCopyWindow(unsigned char* shadow, int16_t stride, int16_t x, int16_t y, int16_t w, int16_t h, const unsigned char* image, int16_t image_stride, unsigned char fill);
+
+#endif /* EPDDIFF_H */
+
+/* END OF FILE */
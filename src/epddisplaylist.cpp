@@ -0,0 +1,210 @@
+/**
+ *  @filename   :   epddisplaylist.cpp
+ *  @brief      :   Display list for banded rendering, see epddisplaylist.h
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <string.h>
+#include "epddisplaylist.h"
+
+// A record is the op, the colour, argc 16 bit arguments and for some ops
+// a pointer or a zero terminated string, all unaligned.
+enum DL_OP {
+  DL_CLEAR,
+  DL_PIXEL,
+  DL_CHAR,
+  DL_STRING,
+  DL_BITMAP,
+  DL_LINE,
+  DL_HORIZONTAL_LINE,
+  DL_VERTICAL_LINE,
+  DL_RECTANGLE,
+  DL_FILLED_RECTANGLE,
+  DL_CIRCLE,
+  DL_FILLED_CIRCLE,
+  DL_PCHAR,                     // proportional fonts
+  DL_PSTRING,
+};
+
+DisplayList::DisplayList(unsigned char* buffer, uint16_t size, ORIENTATION orient, bool inverted)
+  : buffer(buffer), size(size), used(0), overflowed(false), orientation(orient), inverse(inverted)
+{}
+
+/**
+ *  @brief: empties the list
+ */
+void DisplayList::Reset(void)
+{
+  used = 0;
+  overflowed = false;
+}
+
+bool DisplayList::Record(uint8_t op, int16_t colored, const int16_t* args, uint8_t argc, const void* ptr, const char* text)
+{
+  uint16_t len = 2 + argc * sizeof(int16_t);
+  uint16_t textLen = 0;
+
+  if (ptr != NULL) len += sizeof(ptr);
+  if (text != NULL) len += (textLen = strlen(text) + 1);
+  if (used + len > size) {
+    overflowed = true;
+    return false;
+  }
+
+  unsigned char* p = buffer + used;
+  *p++ = op;
+  *p++ = colored;
+  memcpy(p, args, argc * sizeof(int16_t));
+  p += argc * sizeof(int16_t);
+  if (ptr != NULL) {
+    memcpy(p, &ptr, sizeof(ptr));
+    p += sizeof(ptr);
+  }
+  if (text != NULL) {
+    memcpy(p, text, textLen);
+  }
+  used += len;
+  return true;
+}
+
+bool DisplayList::Clear(int16_t colored)
+{
+  return Record(DL_CLEAR, colored, NULL, 0);
+}
+
+bool DisplayList::DrawPixel(int16_t x, int16_t y, int16_t colored)
+{
+  int16_t args[] = { x, y };
+  return Record(DL_PIXEL, colored, args, 2);
+}
+
+bool DisplayList::DrawCharAt(int16_t x, int16_t y, char ascii_char, const sFONT* font, int16_t colored)
+{
+  int16_t args[] = { x, y, ascii_char };
+  return Record(DL_CHAR, colored, args, 3, font);
+}
+
+bool DisplayList::DrawStringAt(int16_t x, int16_t y, const char* text, const sFONT* font, int16_t colored)
+{
+  int16_t args[] = { x, y };
+  return Record(DL_STRING, colored, args, 2, font, text);
+}
+
+bool DisplayList::DrawCharAt(int16_t x, int16_t y, char ascii_char, const pFONT* font, int16_t colored)
+{
+  int16_t args[] = { x, y, ascii_char };
+  return Record(DL_PCHAR, colored, args, 3, font);
+}
+
+bool DisplayList::DrawStringAt(int16_t x, int16_t y, const char* text, const pFONT* font, int16_t colored)
+{
+  int16_t args[] = { x, y };
+  return Record(DL_PSTRING, colored, args, 2, font, text);
+}
+
+bool DisplayList::DrawBitmapAt(int16_t x, int16_t y, const unsigned char* bitmap, int16_t bitmap_width, int16_t bitmap_height, int16_t colored)
+{
+  int16_t args[] = { x, y, bitmap_width, bitmap_height };
+  return Record(DL_BITMAP, colored, args, 4, bitmap);
+}
+
+bool DisplayList::DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored)
+{
+  int16_t args[] = { x0, y0, x1, y1 };
+  return Record(DL_LINE, colored, args, 4);
+}
+
+bool DisplayList::DrawHorizontalLine(int16_t x, int16_t y, int16_t width, int16_t colored)
+{
+  int16_t args[] = { x, y, width };
+  return Record(DL_HORIZONTAL_LINE, colored, args, 3);
+}
+
+bool DisplayList::DrawVerticalLine(int16_t x, int16_t y, int16_t height, int16_t colored)
+{
+  int16_t args[] = { x, y, height };
+  return Record(DL_VERTICAL_LINE, colored, args, 3);
+}
+
+bool DisplayList::DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored)
+{
+  int16_t args[] = { x0, y0, x1, y1 };
+  return Record(DL_RECTANGLE, colored, args, 4);
+}
+
+bool DisplayList::DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored)
+{
+  int16_t args[] = { x0, y0, x1, y1 };
+  return Record(DL_FILLED_RECTANGLE, colored, args, 4);
+}
+
+bool DisplayList::DrawCircle(int16_t x, int16_t y, int16_t radius, int16_t colored)
+{
+  int16_t args[] = { x, y, radius };
+  return Record(DL_CIRCLE, colored, args, 3);
+}
+
+bool DisplayList::DrawFilledCircle(int16_t x, int16_t y, int16_t radius, int16_t colored)
+{
+  int16_t args[] = { x, y, radius };
+  return Record(DL_FILLED_CIRCLE, colored, args, 3);
+}
+
+/**
+ *  @brief: draws the recorded calls into paint, with Paint::SetBand() only
+ *          the part inside the band is drawn
+ */
+void DisplayList::Replay(Paint& paint)
+{
+  const unsigned char* p = buffer;
+  const unsigned char* end = buffer + used;
+  int16_t a[4];
+  const void* ptr = NULL;
+
+  while (p < end) {
+    uint8_t op = *p++;
+    int16_t colored = (int8_t)*p++;
+    uint8_t argc = 0;
+
+    switch (op) {
+      case DL_CLEAR:                                   break;
+      case DL_PIXEL: case DL_STRING: case DL_PSTRING:  argc = 2; break;
+      case DL_CHAR: case DL_PCHAR: case DL_HORIZONTAL_LINE:
+      case DL_VERTICAL_LINE: case DL_CIRCLE:
+      case DL_FILLED_CIRCLE:                           argc = 3; break;
+      default:                                         argc = 4; break;
+    }
+    memcpy(a, p, argc * sizeof(int16_t));
+    p += argc * sizeof(int16_t);
+    if (op == DL_CHAR || op == DL_STRING || op == DL_BITMAP || op == DL_PCHAR || op == DL_PSTRING) {
+      memcpy(&ptr, p, sizeof(ptr));
+      p += sizeof(ptr);
+    }
+
+    switch (op) {
+      case DL_CLEAR:            paint.Clear(colored); break;
+      case DL_PIXEL:            paint.DrawPixel(a[0], a[1], colored); break;
+      case DL_CHAR:             paint.DrawCharAt(a[0], a[1], a[2], (const sFONT*)ptr, colored); break;
+      case DL_STRING:
+        paint.DrawStringAt(a[0], a[1], (const char*)p, (const sFONT*)ptr, colored);
+        p += strlen((const char*)p) + 1;
+        break;
+      case DL_PCHAR:            paint.DrawCharAt(a[0], a[1], a[2], (const pFONT*)ptr, colored); break;
+      case DL_PSTRING:
+        paint.DrawStringAt(a[0], a[1], (const char*)p, (const pFONT*)ptr, colored);
+        p += strlen((const char*)p) + 1;
+        break;
+      case DL_BITMAP:           paint.DrawBitmapAt(a[0], a[1], (const unsigned char*)ptr, a[2], a[3], colored); break;
+      case DL_LINE:             paint.DrawLine(a[0], a[1], a[2], a[3], colored); break;
+      case DL_HORIZONTAL_LINE:  paint.DrawHorizontalLine(a[0], a[1], a[2], colored); break;
+      case DL_VERTICAL_LINE:    paint.DrawVerticalLine(a[0], a[1], a[2], colored); break;
+      case DL_RECTANGLE:        paint.DrawRectangle(a[0], a[1], a[2], a[3], colored); break;
+      case DL_FILLED_RECTANGLE: paint.DrawFilledRectangle(a[0], a[1], a[2], a[3], colored); break;
+      case DL_CIRCLE:           paint.DrawCircle(a[0], a[1], a[2], colored); break;
+      case DL_FILLED_CIRCLE:    paint.DrawFilledCircle(a[0], a[1], a[2], colored); break;
+    }
+  }
+}
+
+/* END OF FILE */
@@ -0,0 +1,57 @@
+/**
+ *  @filename   :   epddisplaylist.h
+ *  @brief      :   Records Paint calls into a small buffer, so a frame can be
+ *                  rendered one horizontal band at a time instead of needing
+ *                  a full frame buffer, see Panel::DisplayFrame(DisplayList&...)
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDDISPLAYLIST_H
+#define EPDDISPLAYLIST_H
+
+#include "epdpaint.h"
+
+class DisplayList {
+public:
+  DisplayList(unsigned char* buffer, uint16_t size, ORIENTATION orient = PORTRAIT, bool inverted = false);
+
+  // same as the Paint methods, false if the buffer is full
+  bool Clear(int16_t colored);
+  bool DrawPixel(int16_t x, int16_t y, int16_t colored);
+  bool DrawCharAt(int16_t x, int16_t y, char ascii_char, const sFONT* font, int16_t colored);
+  bool DrawStringAt(int16_t x, int16_t y, const char* text, const sFONT* font, int16_t colored);
+  bool DrawCharAt(int16_t x, int16_t y, char ascii_char, const pFONT* font, int16_t colored);
+  bool DrawStringAt(int16_t x, int16_t y, const char* text, const pFONT* font, int16_t colored);
+  bool DrawBitmapAt(int16_t x, int16_t y, const unsigned char* bitmap, int16_t bitmap_width, int16_t bitmap_height, int16_t colored);
+  bool DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
+  bool DrawHorizontalLine(int16_t x, int16_t y, int16_t width, int16_t colored);
+  bool DrawVerticalLine(int16_t x, int16_t y, int16_t height, int16_t colored);
+  bool DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
+  bool DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
+  bool DrawCircle(int16_t x, int16_t y, int16_t radius, int16_t colored);
+  bool DrawFilledCircle(int16_t x, int16_t y, int16_t radius, int16_t colored);
+
+  void Replay(Paint& paint);
+  void Reset(void);
+
+  inline uint16_t    GetUsed(void)      { return used; }
+  inline uint16_t    GetSize(void)      { return size; }
+  inline bool        isOverflowed(void) { return overflowed; }
+  inline ORIENTATION GetRotate(void)    { return orientation; }
+  inline bool        isInverse(void)    { return inverse; }
+
+private:
+  bool Record(uint8_t op, int16_t colored, const int16_t* args, uint8_t argc, const void* ptr = NULL, const char* text = NULL);
+
+  unsigned char* buffer;
+  uint16_t       size;
+  uint16_t       used;
+  bool           overflowed;
+  ORIENTATION    orientation;
+  bool           inverse;
+};
+
+#endif /* EPDDISPLAYLIST_H */
+
+/* END OF FILE */
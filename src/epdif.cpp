@@ -28,14 +28,22 @@
 
 #include "epdif.h"
 
+EpdIf* volatile EpdIf::_dmaOwner = NULL;
+
 bool EpdIf::IfInit(void) {
   pinMode(_CS, OUTPUT);
   pinMode(_RST, OUTPUT);
   pinMode(_DC, OUTPUT);
   pinMode(_BUSY, INPUT);
+#if defined(EPDIF_LINUX)
+  // clock and chunking are set up with the SPIClass, see linux/SPI.h
+  _SPI.begin();
+  return (_init = _SPI.isOpen());
+#else
   _SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
   _SPI.begin();
   return (_init = true);
+#endif
 }
 
 int16_t EpdIf::DigitalRead(int16_t pin) 
@@ -50,6 +58,12 @@ int16_t EpdIf::DigitalRead(int16_t pin)
 
 void EpdIf::DigitalWrite(int16_t pin, int16_t value)
 {
+  // DC is shared and CS must not join the transfer of another panel
+  if (pin == _DC || (pin == _CS && !value)) WaitForBus();
+  if (pin == _DC) _dcLow = !value;
+  if (pin == _DC) EPDIF_TRACE(Pin(EPD_TRACE_PIN_DC, value));
+  else if (pin == _CS) EPDIF_TRACE(Pin(EPD_TRACE_PIN_CS, value));
+  else if (pin == _RST) EPDIF_TRACE(Pin(EPD_TRACE_PIN_RST, value));
 #if defined(PARTICLE) && (SYSTEM_VERSION >= 0x00040400)
   if (!_init) IfInit();
   digitalWriteFast(pin, value);
@@ -60,24 +74,395 @@ void EpdIf::DigitalWrite(int16_t pin, int16_t value)
 
 void EpdIf::DelayMs(uint16_t delaytime)
 {
+  uint32_t start = micros();
+
+  EPDIF_TRACE(Record(EPD_TRACE_DELAY, 0, delaytime));
 #if defined(PARTICLE)
   for (uint32_t _ms = millis(); millis() - _ms < delaytime; Particle.process());
 #else
   delay(delaytime);
 #endif
+  _stats.delayUs += micros() - start;
 }
 
 void EpdIf::SpiTransfer(unsigned char data, int16_t len)
 {
-  digitalWrite(_CS, LOW);
+  DigitalWrite(_CS, LOW);
+  CountTransfer(data, len);
+  EPDIF_TRACE(Fill(data, len));
+#if defined(EPDIF_LINUX)
+  _SPI.transferFill(data, len);
+#else
   for(int16_t i=0; i < len; i++)
     _SPI.transfer(data);
-  digitalWrite(_CS, HIGH);
+#endif
+  DigitalWrite(_CS, HIGH);
 }
 
+/**
+ *  @brief: streams a whole buffer with a single chip select cycle,
+ *          the data may live in flash (PROGMEM is plain memory on Particle)
+ */
 void EpdIf::SpiTransfer(const unsigned char *data, int16_t len) {
-  digitalWrite(_CS, LOW);
+  if (len <= 0) return;
+  DigitalWrite(_CS, LOW);
+  CountTransfer(pgm_read_byte(data), len);
+  EPDIF_TRACE(Bytes(data, len));
+#if defined(PARTICLE) || defined(EPDIF_LINUX)
   _SPI.transfer((void*)data, NULL, len, NULL);
-  digitalWrite(_CS, HIGH);
+#else
+  for(int16_t i=0; i < len; i++)
+    _SPI.transfer(pgm_read_byte(&data[i]));
+#endif
+  DigitalWrite(_CS, HIGH);
+}
+
+/**
+ *  @brief: clocks len bytes in from the controller, which drives DIN
+ *          after a read command. That takes DIN wired to MISO as well
+ *          (and to MOSI through a resistor), otherwise MISO floats.
+ */
+void EpdIf::SpiReceive(unsigned char *data, int16_t len) {
+  DigitalWrite(_CS, LOW);
+  for (int16_t i = 0; i < len; i++) {
+    data[i] = _SPI.transfer(0x00);
+  }
+  DigitalWrite(_CS, HIGH);
+}
+
+/**
+ *  @brief: starts streaming a buffer via DMA and returns immediately.
+ *          The buffer has to stay valid until the transfer is done, which
+ *          is signalled by isTransferDone() and the optional callback
+ *          (called from interrupt context).
+ *          Returns false while another transfer is still running.
+ */
+bool EpdIf::SpiTransferAsync(const unsigned char *data, int16_t len, EpdIfCallback callback) {
+  if (_dmaBusy || _dmaOwner != NULL) return false;
+  _dmaCallback = callback;
+  if (len <= 0) {
+    if (callback) callback();
+    return true;
+  }
+#if defined(PARTICLE) || defined(EPDIF_SIM)
+  _dmaBusy = true;
+  _dmaOwner = this;
+  DigitalWrite(_CS, LOW);
+  CountTransfer(data[0], len);
+  EPDIF_TRACE(Bytes(data, len));
+  _SPI.transfer((void*)data, NULL, len, DmaComplete);
+#else
+  SpiTransfer(data, len);
+  if (callback) callback();
+#endif
+  return true;
+}
+
+/**
+ *  @brief: DMA completion handler, releases chip select of the owner
+ */
+void EpdIf::DmaComplete(void) {
+  EpdIf* self = _dmaOwner;
+  if (self == NULL) return;
+
+  self->DigitalWrite(self->_CS, HIGH);
+  _dmaOwner = NULL;
+  self->_dmaBusy = false;
+  if (self->_dmaCallback) self->_dmaCallback();
+}
+
+/**
+ *  @brief: blocks while another panel on the bus streams by DMA, it holds
+ *          DC and its CS until the transfer completed
+ */
+void EpdIf::WaitForBus(void) {
+  while (_dmaOwner != NULL && _dmaOwner != this) yield();
+}
+
+/**
+ *  @brief: blocks until a pending DMA transfer has finished
+ */
+void EpdIf::SpiWaitDone(void) {
+  while (_dmaBusy) yield();
+}
+
+/**
+ *  @brief: appends a command with its data to the upload queue
+ */
+bool EpdIf::QueuePhase(int16_t command, const unsigned char *data, int16_t len, unsigned char fill) {
+  if (_queueCount >= EPDIF_QUEUE_SIZE) return false;
+  EpdIfPhase& phase = _queue[_queueCount++];
+  phase.command = command;
+  phase.data    = data;
+  phase.len     = len;
+  phase.fill    = fill;
+  phase.refresh = false;
+  return true;
+}
+
+/**
+ *  @brief: appends a refresh command, the state machine switches to
+ *          EPD_REFRESHING as soon as it has been sent
+ */
+bool EpdIf::QueueRefresh(unsigned char command) {
+  if (!QueuePhase(command)) return false;
+  _queue[_queueCount - 1].refresh = true;
+  return true;
+}
+
+/**
+ *  @brief: kicks off the queued phases, further progress is made by PollUpload()
+ */
+bool EpdIf::StartUpload(void) {
+  _state = EPD_UPLOADING;
+  PollUpload();
+  return true;
+}
+
+/**
+ *  @brief: advances the upload queue, call this from loop().
+ *          Commands and fills are sent right away, plane data is handed
+ *          to the DMA and the next phase starts once it completed.
+ *          Returns true while the upload is still in progress.
+ */
+bool EpdIf::PollUpload(void) {
+  if (_dmaBusy) return true;
+
+  while (_queueHead < _queueCount) {
+    // another panel on the bus is streaming, retried on the next Poll()
+    if (_dmaOwner != NULL) return true;
+
+    EpdIfPhase& phase = _queue[_queueHead++];
+    if (phase.command != EPDIF_DATA_ONLY) {
+      DigitalWrite(_DC, LOW);
+      SpiTransfer((unsigned char)phase.command);
+    }
+    if (phase.refresh) BeginRefresh();
+    if (phase.len <= 0) continue;
+
+    DigitalWrite(_DC, HIGH);
+    if (phase.data == NULL) {
+      SpiTransfer(phase.fill, phase.len);
+    }
+    else if (!SpiTransferAsync(phase.data, phase.len)) {
+      // the command is out, only the data is retried
+      phase.command = EPDIF_DATA_ONLY;
+      phase.refresh = false;
+      _queueHead--;
+      return true;
+    }
+    else if (_dmaBusy) {
+      return true;
+    }
+  }
+  _queueHead = _queueCount = 0;
+  if (_state == EPD_UPLOADING) _state = EPD_IDLE;
+  return false;
+}
+
+/**
+ *  @brief: marks the start of a display refresh, the panel pulls BUSY
+ *          low until the waveform has been driven
+ */
+void EpdIf::BeginRefresh(void) {
+  if (_sentWindow && !_sentPlane) _stats.partialRefreshes++;
+  else _stats.fullRefreshes++;
+  _sentWindow   = false;
+  _sentPlane    = false;
+  _busySeen     = false;
+  _busyEdge     = false;
+  _refreshStart = micros();
+  _busyPolled   = _refreshStart;
+  _refreshDone  = _refreshStart;
+  _state        = EPD_REFRESHING;
+}
+
+/**
+ *  @brief: BUSY rising edge, stamps the exact refresh completion time
+ */
+void EpdIf::BusyReleased(void) {
+  if (_state != EPD_REFRESHING) return;
+  _refreshDone = micros();
+  _busyEdge    = true;
+}
+
+/**
+ *  @brief: the refresh is over, records its duration. Only a completion
+ *          stamped by the BUSY edge or by polling at most
+ *          EPDIF_PREDICT_POLL_MS apart moves the prediction.
+ */
+void EpdIf::RefreshFinished(void) {
+  uint32_t ms = GetRefreshDuration();
+  uint8_t bucket = 0;
+
+  _state = EPD_IDLE;
+  if (_busyEdge || (_busySeen && _refreshDone - _busyPolled <= EPDIF_PREDICT_POLL_MS * 1000UL)) UpdatePrediction(ms);
+  _prediction = NULL;
+  _stats.refreshLastMs = ms;
+  if (ms < _stats.refreshMinMs) _stats.refreshMinMs = ms;
+  if (ms > _stats.refreshMaxMs) _stats.refreshMaxMs = ms;
+  while (bucket < EPD_STATS_BUCKETS - 1 && ms >= ((uint32_t)EPD_STATS_BUCKET_MS << bucket)) bucket++;
+  _stats.refreshHistogram[bucket]++;
+}
+
+/**
+ *  @brief: scores the prediction of a refresh that drove BUSY and moves
+ *          it towards the measured duration
+ */
+void EpdIf::UpdatePrediction(uint32_t ms) {
+  if (_prediction == NULL) return;
+
+  int32_t error = (int32_t)ms - *_prediction;
+  uint32_t absError = error < 0 ? -error : error;
+
+  _stats.predictions++;
+  if (error > 0) _stats.predictionsLate++;
+  _stats.predictionErrorMs += absError;
+  if (absError > _stats.predictionMaxErrorMs) _stats.predictionMaxErrorMs = absError;
+
+  int32_t next = *_prediction + error / EPDIF_PREDICT_WEIGHT;
+  *_prediction = next > UINT16_MAX ? UINT16_MAX : next;
+}
+
+/**
+ *  @brief: bytes sent with DC low are commands, data is counted for the
+ *          plane of the last DATA_START_TRANSMISSION command
+ */
+void EpdIf::CountTransfer(unsigned char first, int16_t len) {
+  if (_dcLow) {
+    _stats.commands += len;
+    _lastCommand = first;
+    return;
+  }
+  _stats.dataCalls++;
+  switch (_lastCommand) {
+    case 0x10: case 0x14:   // (PARTIAL_)DATA_START_TRANSMISSION_1
+      _stats.bytes[EPD_STATS_BLACK] += len;
+      break;
+    case 0x13: case 0x15:   // (PARTIAL_)DATA_START_TRANSMISSION_2
+      _stats.bytes[EPD_STATS_RED] += len;
+      break;
+    default:
+      _stats.bytes[EPD_STATS_OTHER] += len;
+      break;
+  }
+}
+
+void EpdIf::ResetStats(void) {
+  memset(&_stats, 0, sizeof(_stats));
+  _stats.refreshMinMs = UINT32_MAX;
+}
+
+/**
+ *  @brief: advances the refresh state machine without blocking,
+ *          call this from loop() and do other work while it isn't EPD_IDLE
+ */
+EPD_STATE EpdIf::Poll(void) {
+  switch (_state) {
+    case EPD_UPLOADING:
+      PollUpload();
+      break;
+    case EPD_REFRESHING:
+      if (_busyEdge) {
+        RefreshFinished();
+      }
+      else if (isPanelBusy()) {
+        _busySeen = true;
+        _busyPolled = micros();
+      }
+      else if (_busySeen || (micros() - _refreshStart) / 1000 > EPDIF_BUSY_LATENCY_MS) {
+        _refreshDone = micros();
+        RefreshFinished();
+      }
+      break;
+    default:
+      break;
+  }
+  return _state;
 }
 
+/**
+ *  @brief: blocks until a pending upload and refresh are done and BUSY
+ *          is released, polls without sleeping so no latency is added
+ */
+void EpdIf::WaitUntilIdle(void) {
+  uint32_t start = micros();
+
+  EPDIF_TRACE(Record(EPD_TRACE_WAIT_BEGIN));
+  while (Poll() == EPD_UPLOADING || _state == EPD_REFRESHING) yield();
+  while (_state != EPD_SLEEPING && isPanelBusy()) yield();
+  EPDIF_TRACE(Record(EPD_TRACE_WAIT_END));
+  _stats.waitUs += micros() - start;
+}
+
+/**
+ *  @brief: as WaitUntilIdle(), but stops the MCU while the panel
+ *          refreshes. It wakes on the BUSY edge or shortly after the
+ *          predicted end of the refresh, whichever comes first. Only
+ *          worth it for refreshes with a prediction, see ExpectRefresh().
+ *          The radio is off during the stop unless the application
+ *          keeps it up. Returns true if the MCU was stopped.
+ */
+bool EpdIf::SleepUntilIdle(void) {
+  bool slept = false;
+
+  while (Poll() == EPD_UPLOADING) yield();
+  if (_state == EPD_REFRESHING && _prediction != NULL && isPanelBusy()) {
+    uint32_t elapsed  = (micros() - _refreshStart) / 1000;
+    uint32_t deadline = *_prediction + *_prediction / EPDIF_SLEEP_MARGIN;
+
+    Poll();     // BUSY seen low, the refresh gets measured
+    if (deadline > elapsed + EPDIF_SLEEP_MIN_MS) {
+      uint32_t start = micros();
+
+      slept = SleepUntilBusyReleased(deadline - elapsed);
+      if (slept) {
+        uint32_t sleptUs = micros() - start;
+        _stats.sleepUs += sleptUs;
+        // woken before the deadline, by the BUSY edge
+        if (!isPanelBusy() && sleptUs / 1000 < deadline - elapsed) BusyReleased();
+      }
+    }
+  }
+  WaitUntilIdle();
+  return slept;
+}
+
+/**
+ *  @brief: stop mode until BUSY rises or timeoutMs has passed, returns
+ *          false where the MCU can't be stopped
+ */
+bool EpdIf::SleepUntilBusyReleased(uint32_t timeoutMs) {
+#if defined(PARTICLE) && (SYSTEM_VERSION >= 0x01050000)
+  SystemSleepConfiguration config;
+  config.mode(SystemSleepMode::STOP)
+        .gpio(_BUSY, RISING)
+        .duration(timeoutMs);
+  System.sleep(config);
+  return true;
+#elif defined(PARTICLE)
+  System.sleep(_BUSY, RISING, (timeoutMs + 999) / 1000);
+  return true;
+#else
+  (void)timeoutMs;
+  return false;
+#endif
+}
+
+/**
+ *  @brief: lets the BUSY pin interrupt stamp the refresh completion,
+ *          Poll() is still needed to advance the state
+ */
+bool EpdIf::AttachBusyInterrupt(void) {
+#if defined(PARTICLE)
+  return attachInterrupt(_BUSY, &EpdIf::BusyReleased, this, RISING);
+#else
+  return false;
+#endif
+}
+
+void EpdIf::DetachBusyInterrupt(void) {
+#if defined(PARTICLE)
+  detachInterrupt(_BUSY);
+#endif
+}
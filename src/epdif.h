@@ -31,6 +31,7 @@
 
 #include <Arduino.h>
 #include <SPI.h>
+#include "epdtrace.h"
 
 // Pin definition
 //#define RST_PIN         8
@@ -40,18 +41,103 @@
 
 #if defined(PARTICLE)
 #define yield() Particle.process()
-#else
+#elif !defined(EPDIF_LINUX)
 #define yield() ;
 #endif
 
+// Maximum number of command/data phases of one asynchronous upload
+#define EPDIF_QUEUE_SIZE  6
+
+typedef void (*EpdIfCallback)(void);
+
+// Phase without a command byte, continues the data of the previous phase
+#define EPDIF_DATA_ONLY   -1
+
+// Time after a refresh command within which BUSY has to go low, if it
+// doesn't the refresh is considered done
+#define EPDIF_BUSY_LATENCY_MS  20
+
+// Refresh duration predictions move by 1/EPDIF_PREDICT_WEIGHT of their
+// error with every measured refresh
+#define EPDIF_PREDICT_WEIGHT   4
+
+// Without the BUSY interrupt a refresh only teaches the prediction if
+// BUSY was last seen low at most this long before it was seen released,
+// so a Poll() from a slow loop() doesn't learn its own period
+#define EPDIF_PREDICT_POLL_MS  10
+
+// EpdIf::SleepUntilIdle() only stops the MCU for a refresh expected to
+// take at least this much longer, and sleeps up to 1/EPDIF_SLEEP_MARGIN
+// past the prediction before it polls again
+#define EPDIF_SLEEP_MIN_MS     500
+#define EPDIF_SLEEP_MARGIN     8
+
+// One step of an asynchronous upload: a command byte followed by its data.
+// With data == NULL the phase sends len copies of fill instead.
+struct EpdIfPhase {
+  int16_t              command;
+  const unsigned char* data;
+  int16_t              len;
+  unsigned char        fill;
+  bool                 refresh;
+};
+
+// Refresh duration histogram, bucket i counts refreshes shorter than
+// EPD_STATS_BUCKET_MS << i, the last one all longer ones
+#define EPD_STATS_BUCKETS     8
+#define EPD_STATS_BUCKET_MS   250
+
+// Planes the data bytes went to, by the DATA_START_TRANSMISSION command
+// they followed. The 7.5" panel sends both colours in the black plane.
+enum EPD_STATS_PLANE {
+  EPD_STATS_OTHER,
+  EPD_STATS_BLACK,
+  EPD_STATS_RED,
+  EPD_STATS_PLANES,
+};
+
+// Counters of EpdIf::GetStats(), times in microseconds
+struct EpdStats {
+  uint32_t commands;                    // SendCommand() calls
+  uint32_t dataCalls;                   // SendData() and plane transfers
+  uint32_t bytes[EPD_STATS_PLANES];
+  uint64_t waitUs;                      // blocked in WaitUntilIdle()
+  uint64_t delayUs;                     // fixed DelayMs() waits
+  uint32_t fullRefreshes;
+  uint32_t partialRefreshes;            // only partial windows sent since the last refresh
+  uint32_t refreshLastMs;
+  uint32_t refreshMinMs;
+  uint32_t refreshMaxMs;
+  uint32_t refreshHistogram[EPD_STATS_BUCKETS];
+  uint32_t predictions;                 // measured refreshes that had a prediction
+  uint32_t predictionsLate;             // of those, the ones that took longer
+  uint64_t predictionErrorMs;           // sum of the absolute errors
+  uint32_t predictionMaxErrorMs;
+  uint64_t sleepUs;                     // MCU stopped in SleepUntilIdle()
+};
+
+// Refresh state machine, advanced by EpdIf::Poll()
+enum EPD_STATE {
+  EPD_IDLE,
+  EPD_UPLOADING,
+  EPD_REFRESHING,
+  EPD_SLEEPING,
+};
+
 class EpdIf {
 public:
   EpdIf(void)
     : _SPI(SPI), _CS(10), _DC(9), _RST(8), _BUSY(7), _init(false)
-  {}
+    , _state(EPD_IDLE), _refreshStart(0), _refreshDone(0), _busySeen(false), _busyPolled(0), _busyEdge(false), _prediction(NULL)
+    , _dmaBusy(false), _dmaCallback(NULL), _queueHead(0), _queueCount(0), _trace(NULL)
+    , _dcLow(false), _lastCommand(0), _sentWindow(false), _sentPlane(false)
+  { ResetStats(); }
   EpdIf(SPIClass& hwSPI, int16_t pinCS, int16_t pinDC, int16_t pinReset, int16_t pinBusy)
     : _SPI(hwSPI), _CS(pinCS), _DC(pinDC), _RST(pinReset), _BUSY(pinBusy), _init(false)
-  {}
+    , _state(EPD_IDLE), _refreshStart(0), _refreshDone(0), _busySeen(false), _busyPolled(0), _busyEdge(false), _prediction(NULL)
+    , _dmaBusy(false), _dmaCallback(NULL), _queueHead(0), _queueCount(0), _trace(NULL)
+    , _dcLow(false), _lastCommand(0), _sentWindow(false), _sentPlane(false)
+  { ResetStats(); }
 
   ~EpdIf(void)
   {}
@@ -62,14 +148,86 @@ public:
   void    DelayMs(uint16_t delaytime);
   void    SpiTransfer(unsigned char data, int16_t len = 1);
   void    SpiTransfer(const unsigned char *data, int16_t len);
+  bool    SpiTransferAsync(const unsigned char *data, int16_t len, EpdIfCallback callback = NULL);
+  void    SpiReceive(unsigned char *data, int16_t len);
+  void    SpiWaitDone(void);
+  bool    PollUpload(void);
+  EPD_STATE Poll(void);
+  void    WaitUntilIdle(void);
+  bool    SleepUntilIdle(void);
+  bool    AttachBusyInterrupt(void);
+  void    DetachBusyInterrupt(void);
+  void    ResetStats(void);
+  inline const EpdStats& GetStats(void) { return _stats; }
+  // records the traffic when built with EPD_TRACE, NULL stops
+  inline void SetTrace(EpdTrace* trace) { _trace = trace; }
+
+  inline bool isTransferDone(void) { return !_dmaBusy; }
+  inline bool isUploadDone(void)   { return !_dmaBusy && _queueHead >= _queueCount; }
+  inline EPD_STATE GetState(void)  { return _state; }
+  // micros() timestamps of the last refresh command and the BUSY release,
+  // which is exact with AttachBusyInterrupt(), otherwise it is the Poll()
+  // that first saw BUSY high and can be late by the polling period
+  inline uint32_t GetRefreshStarted(void)   { return _refreshStart; }
+  inline uint32_t GetRefreshCompleted(void) { return _refreshDone; }
+  inline uint32_t GetRefreshDuration(void)  { return (_refreshDone - _refreshStart) / 1000; }
 
 protected:
+  bool    QueuePhase(int16_t command, const unsigned char *data = NULL, int16_t len = 0, unsigned char fill = 0x00);
+  bool    QueueRefresh(unsigned char command);
+  bool    StartUpload(void);
+  void    BeginRefresh(void);
+  inline bool isPanelBusy(void) { return !DigitalRead(_BUSY); } //LOW: busy, HIGH: idle
+  // what the next refresh shows, for the full/partial refresh counts
+  inline void NoteWindow(void) { _sentWindow = true; }
+  inline void NotePlane(void)  { _sentPlane = true; }
+  // duration the next refresh is expected to take, the measurement
+  // updates it once the refresh is over
+  inline void ExpectRefresh(uint16_t* prediction) { _prediction = prediction; }
+
   SPIClass& _SPI;
   int16_t   _CS;
   int16_t   _DC;
   int16_t   _RST;
   int16_t   _BUSY;
   bool      _init;
+  volatile EPD_STATE _state;
+
+private:
+  static void DmaComplete(void);
+  static EpdIf* volatile _dmaOwner;
+  void    WaitForBus(void);
+  void    BusyReleased(void);
+  void    RefreshFinished(void);
+  void    CountTransfer(unsigned char first, int16_t len);
+  void    UpdatePrediction(uint32_t ms);
+  bool    SleepUntilBusyReleased(uint32_t timeoutMs);
+
+  volatile uint32_t _refreshStart;
+  volatile uint32_t _refreshDone;
+  bool          _busySeen;
+  uint32_t      _busyPolled;    // micros() of the last Poll() that saw BUSY low
+  volatile bool _busyEdge;
+  uint16_t*     _prediction;
+
+  volatile bool _dmaBusy;
+  EpdIfCallback _dmaCallback;
+  EpdIfPhase    _queue[EPDIF_QUEUE_SIZE];
+  uint8_t       _queueHead;
+  uint8_t       _queueCount;
+  EpdTrace*     _trace;
+
+  EpdStats      _stats;
+  bool          _dcLow;
+  unsigned char _lastCommand;
+  bool          _sentWindow;
+  bool          _sentPlane;
 };
 
+#if defined(EPD_TRACE)
+#define EPDIF_TRACE(call)   do { if (_trace != NULL) _trace->call; } while (0)
+#else
+#define EPDIF_TRACE(call)   do {} while (0)
+#endif
+
 #endif
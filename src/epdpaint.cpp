@@ -32,6 +32,9 @@ Paint::Paint(unsigned char* image, int16_t screenWidth, int16_t screenHeight, OR
   /* 1 byte = 8 pixels, so the width should be the multiple of 8 */
   this->width = screenWidth % 8 ? screenWidth + 8 - (screenWidth % 8) : screenWidth;
   this->height = screenHeight;
+  this->bandTop = 0;
+  this->bandRows = screenHeight;
+  this->pixels = 0;
   this->orientation = orientation;
   this->inverse = inverted;
 
@@ -44,7 +47,7 @@ Paint::~Paint() {}
  *  @brief: clear the image
  */
 void Paint::Clear(int16_t colored) {
-  memset(this->image, ((bool)colored != this->inverse) ? 0xFF : 0x00, this->height * this->width / 8);
+  FillAbsoluteRect(0, 0, this->width - 1, this->height - 1, colored);
 }
 
 /**
@@ -55,12 +58,167 @@ void Paint::DrawAbsolutePixel(int16_t x, int16_t y, int16_t colored) {
   if (x < 0 || x >= this->width || y < 0 || y >= this->height)
     return;
 
+  MarkDirty(x, y, x, y);
+  SetAbsolutePixel(x, y, colored);
+}
+
+/**
+ *  @brief: writes the pixel without marking it dirty,
+ *          the caller has marked the area it draws into
+ */
+inline void Paint::SetAbsolutePixel(int16_t x, int16_t y, int16_t colored) {
+  y -= this->bandTop;
+  if (x < 0 || x >= this->width || y < 0 || y >= this->bandRows)
+    return;
+  this->pixels++;
+
   if ((bool)colored != this->inverse)
     image[(x + y * this->width) / 8] |= 0x80 >> (x % 8);
   else
     image[(x + y * this->width) / 8] &= ~(0x80 >> (x % 8));
 }
 
+/**
+ *  @brief: this fills a rectangle by absolute coordinates (corners included).
+ *          it's clipped once and written a byte row at a time, only the
+ *          edge bytes of each row need masking.
+ *          this function won't be affected by the rotate parameter.
+ */
+void Paint::FillAbsoluteRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= this->width) x1 = this->width - 1;
+  if (y1 >= this->height) y1 = this->height - 1;
+  if (x0 > x1 || y0 > y1)
+    return;
+
+  MarkDirty(x0, y0, x1, y1);
+  WriteRect(x0, y0, x1, y1, colored);
+}
+
+/**
+ *  @brief: writes a rectangle (absolute coordinates, corners included)
+ *          without marking it dirty, the caller has marked the area it
+ *          draws into
+ */
+void Paint::WriteRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
+  if (x0 < 0) x0 = 0;
+  if (x1 >= this->width) x1 = this->width - 1;
+  if (y0 < this->bandTop) y0 = this->bandTop;
+  if (y1 >= this->bandTop + this->bandRows) y1 = this->bandTop + this->bandRows - 1;
+  if (y1 >= this->height) y1 = this->height - 1;
+  if (x0 > x1 || y0 > y1)
+    return;
+
+  int16_t stride = this->width / 8;
+  unsigned char fill = ((bool)colored != this->inverse) ? 0xFF : 0x00;
+  unsigned char* row = &image[(y0 - this->bandTop) * stride];
+
+  this->pixels += (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+  if (x0 == 0 && x1 == this->width - 1) {
+    memset(row, fill, (y1 - y0 + 1) * stride);
+    return;
+  }
+
+  int16_t first = x0 / 8;
+  int16_t last = x1 / 8;
+  unsigned char first_mask = 0xFF >> (x0 % 8);
+  unsigned char last_mask = 0xFF << (7 - x1 % 8);
+  if (first == last)
+    first_mask &= last_mask;
+
+  for (int16_t y = y0; y <= y1; y++, row += stride) {
+    row[first] = (row[first] & ~first_mask) | (fill & first_mask);
+    if (first == last)
+      continue;
+    memset(&row[first + 1], fill, last - first - 1);
+    row[last] = (row[last] & ~last_mask) | (fill & last_mask);
+  }
+}
+
+/**
+ *  @brief: fills a rectangle given by its corners in rotated coordinates,
+ *          the rotation maps it onto one absolute rectangle
+ */
+void Paint::FillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
+  TransformXY(&x0, &y0);
+  TransformXY(&x1, &y1);
+  FillAbsoluteRect(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0, colored);
+}
+
+/**
+ *  @brief: adds an area (absolute coordinates) to the region.
+ *          it's widened to whole bytes and merged with every rectangle it
+ *          overlaps or touches, a full region merges it with the one that
+ *          grows least.
+ */
+void PaintRegion::Add(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  x0 &= ~7;
+  x1 |= 7;
+
+  uint8_t i;
+  for (i = 0; i < count; i++) {
+    const PaintRect& r = rect[i];
+    if (x0 >= r.x0 && x1 <= r.x1 && y0 >= r.y0 && y1 <= r.y1)
+      return;
+  }
+
+  for (i = 0; i < count; ) {
+    const PaintRect& r = rect[i];
+    if (x0 <= r.x1 + 1 && x1 + 1 >= r.x0 && y0 <= r.y1 + 1 && y1 + 1 >= r.y0) {
+      // absorb it, the union may touch the ones already checked
+      if (r.x0 < x0) x0 = r.x0;
+      if (r.y0 < y0) y0 = r.y0;
+      if (r.x1 > x1) x1 = r.x1;
+      if (r.y1 > y1) y1 = r.y1;
+      rect[i] = rect[--count];
+      i = 0;
+    }
+    else {
+      i++;
+    }
+  }
+
+  if (count == PAINT_DIRTY_RECTS) {
+    uint8_t best = 0;
+    int32_t bestGrowth = INT32_MAX;
+    for (i = 0; i < count; i++) {
+      const PaintRect& r = rect[i];
+      int32_t w = (r.x1 > x1 ? r.x1 : x1) - (r.x0 < x0 ? r.x0 : x0) + 1;
+      int32_t h = (r.y1 > y1 ? r.y1 : y1) - (r.y0 < y0 ? r.y0 : y0) + 1;
+      int32_t growth = w * h - (int32_t)(r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+      if (growth < bestGrowth) {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    PaintRect r = rect[best];
+    rect[best] = rect[--count];
+    Add(r.x0 < x0 ? r.x0 : x0, r.y0 < y0 ? r.y0 : y0, r.x1 > x1 ? r.x1 : x1, r.y1 > y1 ? r.y1 : y1);
+    return;
+  }
+
+  PaintRect& r = rect[count++];
+  r.x0 = x0;
+  r.y0 = y0;
+  r.x1 = x1;
+  r.y1 = y1;
+}
+
+/**
+ *  @brief: adds an area (absolute coordinates) to the dirty region
+ */
+void Paint::MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= this->width) x1 = this->width - 1;
+  if (y1 >= this->height) y1 = this->height - 1;
+  if (x0 > x1 || y0 > y1)
+    return;
+
+  dirty.Add(x0, y0, x1, y1);
+}
+
 /**
  *  @brief: Getters and Setters
  */
@@ -68,6 +226,36 @@ unsigned char* Paint::GetImage(void) {
   return this->image;
 }
 
+int16_t Paint::GetStride(void) {
+  return this->width / 8;
+}
+
+bool Paint::isDirty(void) {
+  return dirty.GetCount() > 0;
+}
+
+uint8_t Paint::GetDirtyCount(void) {
+  return dirty.GetCount();
+}
+
+const PaintRect& Paint::GetDirtyRect(uint8_t index) {
+  return dirty.Get(index);
+}
+
+void Paint::ClearDirty(void) {
+  dirty.Clear();
+}
+
+/**
+ *  @brief: lets image hold only rows top..top + rows - 1 of the frame,
+ *          drawing keeps using frame coordinates and skips the other rows.
+ *          This renders a frame in horizontal bands, see DisplayList.
+ */
+void Paint::SetBand(int16_t top, int16_t rows) {
+  this->bandTop = top;
+  this->bandRows = rows;
+}
+
 int16_t Paint::GetWidth(void) {
   switch (this->orientation) {
     case PORTRAIT:
@@ -112,8 +300,36 @@ ORIENTATION Paint::GetRotate(void) {
   return this->orientation;
 }
 
+/**
+ *  @brief: binds the pixel and glyph writers of the orientation, so the
+ *          inner loops don't have to look at it per pixel
+ */
 void Paint::SetRotate(ORIENTATION orientation) {
   this->orientation = orientation;
+
+  switch (orientation) {
+    default:
+    case PORTRAIT:
+      pixelWriter = &Paint::DrawRotatedPixel<PORTRAIT>;
+      bitmapWriter = &Paint::BlitBitmap<PORTRAIT>;
+      columnWriter = NULL;
+      break;
+    case LANDSCAPE:
+      pixelWriter = &Paint::DrawRotatedPixel<LANDSCAPE>;
+      bitmapWriter = &Paint::DrawRotatedBitmap<LANDSCAPE>;
+      columnWriter = &Paint::BlitColumns<LANDSCAPE>;
+      break;
+    case PORTRAIT_FLIPPED:
+      pixelWriter = &Paint::DrawRotatedPixel<PORTRAIT_FLIPPED>;
+      bitmapWriter = &Paint::BlitBitmap<PORTRAIT_FLIPPED>;
+      columnWriter = NULL;
+      break;
+    case LANDSCAPE_FLIPPED:
+      pixelWriter = &Paint::DrawRotatedPixel<LANDSCAPE_FLIPPED>;
+      bitmapWriter = &Paint::DrawRotatedBitmap<LANDSCAPE_FLIPPED>;
+      columnWriter = &Paint::BlitColumns<LANDSCAPE_FLIPPED>;
+      break;
+  }
 }
 
 bool Paint::isInverse(void) {
@@ -127,67 +343,247 @@ bool Paint::isInverse(bool invert) {
 }
 
 /**
- *  @brief: this draws a pixel by the coordinates
+ *  @brief: maps rotated coordinates onto the absolute ones,
+ *          O is a constant so the switch folds away
  */
-void Paint::TransformXY(int16_t* x, int16_t* y) {
+template <ORIENTATION O>
+inline void Paint::Rotate(int16_t* x, int16_t* y) {
   int16_t dmy;
 
-  switch (this->orientation) {
+  switch (O) {
     default:
     case PORTRAIT:
       break;
     case LANDSCAPE:
       dmy = *x;
-      *x = this->width - *y;
+      *x = this->width - 1 - *y;
       *y = dmy;
       break;
     case PORTRAIT_FLIPPED:
-      *x = this->width - *x;
-      *y = this->height - *y;
+      *x = this->width - 1 - *x;
+      *y = this->height - 1 - *y;
       break;
     case LANDSCAPE_FLIPPED:
       dmy = *x;
       *x = *y;
-      *y = this->height - *x;
+      *y = this->height - 1 - dmy;
       break;
   }
 }
 
+void Paint::TransformXY(int16_t* x, int16_t* y) {
+  switch (this->orientation) {
+    default:
+    case PORTRAIT:          Rotate<PORTRAIT>(x, y);          break;
+    case LANDSCAPE:         Rotate<LANDSCAPE>(x, y);         break;
+    case PORTRAIT_FLIPPED:  Rotate<PORTRAIT_FLIPPED>(x, y);  break;
+    case LANDSCAPE_FLIPPED: Rotate<LANDSCAPE_FLIPPED>(x, y); break;
+  }
+}
+
+template <ORIENTATION O>
+void Paint::DrawRotatedPixel(int16_t x, int16_t y, int16_t colored) {
+  Rotate<O>(&x, &y);
+  DrawAbsolutePixel(x, y, colored);
+}
+
 /**
  *  @brief: this draws a pixel by the coordinates
  */
 void Paint::DrawPixel(int16_t x, int16_t y, int16_t colored) {
-  TransformXY(&x, &y);
-  if (x < 0 || x >= this->width || y < 0 || y >= this->height)
-    return;
-  DrawAbsolutePixel(x, y, colored);
+  (this->*pixelWriter)(x, y, colored);
 }
 
 /**
  *  @brief: this draws a charactor on the frame buffer but not refresh
  */
 void Paint::DrawCharAt(int16_t x, int16_t y, char ascii_char, const sFONT* font, int16_t colored) {
+  /* the tables hold ' ' to '~' only, anything else leaves the cell blank */
+  if (ascii_char < ' ' || ascii_char > '~')
+    return;
+  if (font->Columns != NULL && columnWriter != NULL) {
+    uint16_t column_offset = (ascii_char - ' ') * font->Width * ((font->Height + 7) / 8);
+    (this->*columnWriter)(x, y, &font->Columns[column_offset], font->Width, font->Height, colored);
+    return;
+  }
+  uint16_t char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
+  (this->*bitmapWriter)(x, y, &font->table[char_offset], font->Width, font->Height, colored);
+}
+
+/**
+ *  @brief: this draws the set pixels of a 1bpp bitmap, rows are padded to
+ *          whole bytes like the font glyphs
+ */
+void Paint::DrawBitmapAt(int16_t x, int16_t y, const unsigned char* bitmap, int16_t bitmap_width, int16_t bitmap_height, int16_t colored) {
+  (this->*bitmapWriter)(x, y, bitmap, bitmap_width, bitmap_height, colored);
+}
+
+template <ORIENTATION O>
+void Paint::DrawRotatedBitmap(int16_t x, int16_t y, const unsigned char* ptr, int16_t w, int16_t h, int16_t colored) {
   int16_t i;
   int16_t j;
+  int16_t x0 = x;
+  int16_t y0 = y;
+  int16_t x1 = x + w - 1;
+  int16_t y1 = y + h - 1;
 
-  uint16_t char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-  const unsigned char* ptr = &font->table[char_offset];
+  Rotate<O>(&x0, &y0);
+  Rotate<O>(&x1, &y1);
+  MarkDirty(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0);
 
-  for (j = 0; j < font->Height; j++) {
-    for (i = 0; i < font->Width; i++) {
+  for (j = 0; j < h; j++) {
+    for (i = 0; i < w; i++) {
       if (pgm_read_byte(ptr) & (0x80 >> (i % 8))) {
-        DrawPixel(x + i, y + j, colored);
+        int16_t px = x + i;
+        int16_t py = y + j;
+        Rotate<O>(&px, &py);
+        SetAbsolutePixel(px, py, colored);
       }
       if (i % 8 == 7) {
         ptr++;
       }
     }
-    if (font->Width % 8 != 0) {
+    if (w % 8 != 0) {
       ptr++;
     }
   }
 }
 
+/**
+ *  @brief: mirrors the bits of a byte, for the flipped row blits
+ */
+static inline unsigned char ReverseBits(unsigned char b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  return (b & 0xAA) >> 1 | (b & 0x55) << 1;
+}
+
+/**
+ *  @brief: the bitmap writer of the portrait orientations, where bitmap
+ *          rows stay image rows (mirrored when flipped)
+ */
+template <ORIENTATION O>
+void Paint::BlitBitmap(int16_t x, int16_t y, const unsigned char* ptr, int16_t w, int16_t h, int16_t colored) {
+  if (O == PORTRAIT_FLIPPED)
+    BlitRows<true, true>(this->width - x - w, this->height - y - h, ptr, w, h, colored);
+  else
+    BlitRows<false, false>(x, y, ptr, w, h, colored);
+}
+
+/**
+ *  @brief: the glyph writer of the landscape orientations, takes the
+ *          glyph columns made by RotateFont(), which are image rows here
+ */
+template <ORIENTATION O>
+void Paint::BlitColumns(int16_t x, int16_t y, const unsigned char* columns, int16_t w, int16_t h, int16_t colored) {
+  if (O == LANDSCAPE)
+    BlitRows<true, false>(this->width - y - h, x, columns, h, w, colored);
+  else
+    BlitRows<false, true>(y, this->height - x - w, columns, h, w, colored);
+}
+
+/**
+ *  @brief: draws the set pixels of a bitmap whose rows are image rows,
+ *          (x0, y0) being its top left corner in absolute coordinates.
+ *          It clips once, then ORs (or AND-NOTs) each row into the image
+ *          up to 24 bits at a time, shifted to the destination bit offset.
+ */
+template <bool MIRROR_X, bool MIRROR_Y>
+void Paint::BlitRows(int16_t x0, int16_t y0, const unsigned char* ptr, int16_t w, int16_t h, int16_t colored) {
+  int16_t row_bytes = (w + 7) / 8;
+  int16_t stride = this->width / 8;
+  int16_t x1 = x0 + w - 1;
+  int16_t y1 = y0 + h - 1;
+
+  if (w <= 0 || h <= 0 || x1 < 0 || x0 >= this->width || y1 < 0 || y0 >= this->height)
+    return;
+  MarkDirty(x0, y0, x1, y1);
+
+  int16_t top = y0 > this->bandTop ? y0 : this->bandTop;
+  int16_t bottom = y1 < this->bandTop + this->bandRows - 1 ? y1 : this->bandTop + this->bandRows - 1;
+  if (bottom >= this->height) bottom = this->height - 1;
+  if (top > bottom)
+    return;
+
+  // the mirrored row is written from its padding on, left of x0
+  int16_t left = MIRROR_X ? x0 - (row_bytes * 8 - w) : x0;
+  int16_t shift = left & 7;
+  int16_t first = (left - shift) / 8;
+  unsigned char tail_mask = w % 8 ? 0xFF << (8 - w % 8) : 0xFF;
+  bool set = (bool)colored != this->inverse;
+  bool clipped = first < 0 || first + row_bytes + (shift != 0) > stride;
+
+  for (int16_t ay = top; ay <= bottom; ay++) {
+    const unsigned char* src = ptr + (MIRROR_Y ? y1 - ay : ay - y0) * row_bytes;
+    unsigned char* row = &image[(ay - this->bandTop) * stride];
+
+    for (int16_t k = 0; k < row_bytes; k += 3) {
+      uint32_t word = 0;
+      for (int16_t b = 0; b < 3 && k + b < row_bytes; b++) {
+        int16_t i = MIRROR_X ? row_bytes - 1 - (k + b) : k + b;
+        unsigned char bits = pgm_read_byte(&src[i]);
+        if (i == row_bytes - 1) bits &= tail_mask;
+        word |= (uint32_t)(MIRROR_X ? ReverseBits(bits) : bits) << (24 - 8 * b);
+      }
+      word >>= shift;
+      if (!clipped) this->pixels += __builtin_popcount(word);
+
+      for (int16_t bx = first + k; word != 0; bx++, word <<= 8) {
+        unsigned char bits = word >> 24;
+        if (clipped) {
+          if (bits == 0 || bx < 0 || bx >= stride) continue;
+          this->pixels += __builtin_popcount(bits);
+        }
+        if (set)
+          row[bx] |= bits;
+        else
+          row[bx] &= ~bits;
+      }
+    }
+  }
+}
+
+/**
+ *  @brief: bytes RotateFont() needs for the font, one column of
+ *          (Height + 7) / 8 bytes per glyph column
+ */
+int32_t Paint::GetRotatedFontSize(const sFONT* font) {
+  return (int32_t)FONT_GLYPHS * font->Width * ((font->Height + 7) / 8);
+}
+
+/**
+ *  @brief: makes the column-major copy of a font the landscape
+ *          orientations draw from, so rotated text is blitted a row at a
+ *          time as well. The buffer (GetRotatedFontSize() bytes, usually
+ *          RAM) has to stay valid while the font is used, NULL drops the
+ *          copy again.
+ */
+bool Paint::RotateFont(sFONT* font, uint8_t* buffer, int32_t size) {
+  if (buffer == NULL) {
+    font->Columns = NULL;
+    return true;
+  }
+  if (size < GetRotatedFontSize(font))
+    return false;
+
+  int16_t row_bytes = (font->Width + 7) / 8;
+  int16_t col_bytes = (font->Height + 7) / 8;
+  const uint8_t* glyph = font->table;
+  uint8_t* column = buffer;
+
+  memset(buffer, 0, GetRotatedFontSize(font));
+  for (int16_t g = 0; g < FONT_GLYPHS; g++, glyph += font->Height * row_bytes) {
+    for (int16_t i = 0; i < font->Width; i++, column += col_bytes) {
+      for (int16_t j = 0; j < font->Height; j++) {
+        if (pgm_read_byte(&glyph[j * row_bytes + i / 8]) & (0x80 >> (i % 8)))
+          column[j / 8] |= 0x80 >> (j % 8);
+      }
+    }
+  }
+  font->Columns = buffer;
+  return true;
+}
+
 /**
 *  @brief: this displays a string on the frame buffer but not refresh
 */
@@ -195,19 +591,217 @@ void Paint::DrawStringAt(int16_t x, int16_t y, const char* text, const sFONT* fo
   const char* p_text = text;
   uint16_t counter = 0;
   int16_t refcolumn = x;
+  /* the rest of the string is past the right edge once refcolumn is */
+  int16_t right = (this->orientation == LANDSCAPE || this->orientation == LANDSCAPE_FLIPPED) ? this->height : this->width;
 
-  /* Send the string character by character on EPD */
-  while (*p_text != 0) {
+  /* Send the string character by character on EPD, a UTF-8 sequence
+     takes one cell */
+  while (*p_text != 0 && refcolumn < right) {
+    uint16_t code = NextCodePoint(&p_text);
 /* Display one character on EPD */
-    DrawCharAt(refcolumn, y, *p_text, font, colored);
+    if (code <= '~')
+      DrawCharAt(refcolumn, y, code, font, colored);
     /* Decrement the column position by 16 */
     refcolumn += font->Width;
-    /* Point on the next character */
-    p_text++;
     counter++;
   }
 }
 
+/**
+ *  @brief: draws a glyph of a proportional font with its line top at y and
+ *          returns the advance. Where glyph rows are image rows the glyph
+ *          is unpacked to padded rows and blitted, otherwise each run of
+ *          set pixels in a glyph row is written as one span. Glyphs outside
+ *          the canvas or the band are only measured.
+ */
+int16_t Paint::DrawGlyph(int16_t x, int16_t y, uint16_t code, const pFONT* font, int16_t colored) {
+  const pGLYPH* glyph = FindGlyph(font, code);
+  if (glyph == NULL)
+    return 0;
+
+  int16_t w = pgm_read_byte(&glyph->Width);
+  int16_t h = pgm_read_byte(&glyph->Height);
+  int16_t advance = pgm_read_byte(&glyph->XAdvance);
+  if (w == 0 || h == 0)
+    return advance;
+
+  int16_t gx = x + (int8_t)pgm_read_byte(&glyph->XOffset);
+  int16_t gy = y + (int8_t)pgm_read_byte(&glyph->YOffset);
+  const uint8_t* bits = font->Bitmap + pgm_read_word(&glyph->Offset);
+  int16_t row_bytes = (w + 7) / 8;
+
+  if (columnWriter == NULL && row_bytes * h <= PAINT_GLYPH_BYTES) {
+    unsigned char rows[PAINT_GLYPH_BYTES];
+    unsigned char* dst = rows;
+    uint16_t bit = 0;
+
+    for (int16_t j = 0; j < h; j++, bit += w) {
+      for (int16_t k = 0; k < w; k += 8) {
+        uint16_t pos = bit + k;
+        uint8_t shift = pos % 8;
+        uint8_t n = w - k < 8 ? w - k : 8;
+        uint8_t v = pgm_read_byte(&bits[pos / 8]) << shift;
+        if (shift + n > 8) v |= pgm_read_byte(&bits[pos / 8 + 1]) >> (8 - shift);
+        *dst++ = v & (0xFF << (8 - n));
+      }
+    }
+    (this->*bitmapWriter)(gx, gy, rows, w, h, colored);
+    return advance;
+  }
+
+  int16_t x0 = gx;
+  int16_t y0 = gy;
+  int16_t x1 = gx + w - 1;
+  int16_t y1 = gy + h - 1;
+
+  TransformXY(&x0, &y0);
+  TransformXY(&x1, &y1);
+  if (x0 > x1) { int16_t t = x0; x0 = x1; x1 = t; }
+  if (y0 > y1) { int16_t t = y0; y0 = y1; y1 = t; }
+  if (x1 < 0 || x0 >= this->width || y1 < 0 || y0 >= this->height)
+    return advance;
+  MarkDirty(x0, y0, x1, y1);
+  if (y1 < this->bandTop || y0 >= this->bandTop + this->bandRows)
+    return advance;
+
+  uint16_t bit = 0;
+  uint8_t byte = 0;
+
+  for (int16_t j = 0; j < h; j++) {
+    int16_t start = -1;
+    for (int16_t i = 0; i <= w; i++, bit++) {
+      bool set = false;
+      if (i < w) {
+        if (bit % 8 == 0) byte = pgm_read_byte(&bits[bit / 8]);
+        set = byte & (0x80 >> (bit % 8));
+      }
+      if (set && start < 0) {
+        start = i;
+      }
+      else if (!set && start >= 0) {
+        int16_t sx0 = gx + start, sy0 = gy + j;
+        int16_t sx1 = gx + i - 1, sy1 = gy + j;
+        TransformXY(&sx0, &sy0);
+        TransformXY(&sx1, &sy1);
+        WriteRect(sx0 < sx1 ? sx0 : sx1, sy0 < sy1 ? sy0 : sy1, sx0 < sx1 ? sx1 : sx0, sy0 < sy1 ? sy1 : sy0, colored);
+        start = -1;
+      }
+    }
+    bit--;                      // the i == w step isn't a bit
+  }
+  return advance;
+}
+
+/**
+ *  @brief: this draws a character of a proportional font, y is the top
+ *          of the line. The char is taken as Latin-1, which are the first
+ *          256 code points.
+ */
+void Paint::DrawCharAt(int16_t x, int16_t y, char ascii_char, const pFONT* font, int16_t colored) {
+  DrawGlyph(x, y, (uint8_t)ascii_char, font, colored);
+}
+
+/**
+ *  @brief: this draws a UTF-8 string of a proportional font, y is the top
+ *          of the line
+ */
+void Paint::DrawStringAt(int16_t x, int16_t y, const char* text, const pFONT* font, int16_t colored) {
+  DrawStringAt(x, y, text, 0xFFFF, font, colored);
+}
+
+/**
+ *  @brief: same for the first length bytes of text at most, for drawing
+ *          parts of a string such as the lines of a TextBox
+ */
+void Paint::DrawStringAt(int16_t x, int16_t y, const char* text, uint16_t length, const pFONT* font, int16_t colored) {
+  int16_t right = (this->orientation == LANDSCAPE || this->orientation == LANDSCAPE_FLIPPED) ? this->height : this->width;
+  const char* start = text;
+
+  while (*text != 0 && text - start < length && x < right)
+    x += DrawGlyph(x, y, NextCodePoint(&text), font, colored);
+}
+
+/**
+ *  @brief: width of a UTF-8 string in a proportional font, the sum of its
+ *          advances
+ */
+int16_t Paint::GetStringWidth(const char* text, const pFONT* font) {
+  return GetStringWidth(text, 0xFFFF, font);
+}
+
+int16_t Paint::GetStringWidth(const char* text, uint16_t length, const pFONT* font) {
+  const char* start = text;
+  int16_t width = 0;
+
+  while (*text != 0 && text - start < length) {
+    const pGLYPH* glyph = FindGlyph(font, NextCodePoint(&text));
+    if (glyph != NULL)
+      width += pgm_read_byte(&glyph->XAdvance);
+  }
+  return width;
+}
+
+/**
+ *  @brief: the glyph of a code point, a binary search of the font's
+ *          ranges. Missing ones get the glyph of the font's fallback,
+ *          NULL if that's missing too.
+ */
+const pGLYPH* Paint::FindGlyph(const pFONT* font, uint16_t code) {
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    int16_t lo = 0;
+    int16_t hi = font->RangeCount - 1;
+
+    while (lo <= hi) {
+      int16_t mid = (lo + hi) / 2;
+      const pRANGE* range = &font->Ranges[mid];
+      uint16_t first = pgm_read_word(&range->First);
+
+      if (code < first)
+        hi = mid - 1;
+      else if (code > pgm_read_word(&range->Last))
+        lo = mid + 1;
+      else
+        return &font->Glyphs[pgm_read_word(&range->Glyph) + code - first];
+    }
+    if (font->Fallback == 0 || code == font->Fallback)
+      break;
+    code = font->Fallback;
+  }
+  return NULL;
+}
+
+/**
+ *  @brief: decodes the UTF-8 character at *text and moves *text past it.
+ *          Malformed and overlong sequences and every 4 byte sequence,
+ *          which would be beyond 0xFFFF, come back as U+FFFD, a truncated
+ *          sequence doesn't swallow what follows it.
+ */
+uint16_t Paint::NextCodePoint(const char** text) {
+  const uint8_t* p = (const uint8_t*)*text;
+  uint8_t lead = *p++;
+  uint32_t code;
+  uint8_t extra;
+
+  if (lead < 0x80)                     { code = lead;        extra = 0; }
+  else if (lead >= 0xC2 && lead < 0xE0) { code = lead & 0x1F; extra = 1; }
+  else if (lead >= 0xE0 && lead < 0xF0) { code = lead & 0x0F; extra = 2; }
+  else if (lead >= 0xF0 && lead < 0xF5) { code = lead & 0x07; extra = 3; }
+  else                                 { code = 0xFFFD;      extra = 0; }
+
+  for (; extra > 0; extra--) {
+    if ((*p & 0xC0) != 0x80) {
+      code = 0xFFFD;
+      break;
+    }
+    code = code << 6 | (*p++ & 0x3F);
+  }
+  *text = (const char*)p;
+
+  if (lead >= 0xF0 || (lead >= 0xE0 && code < 0x800) || (code >= 0xD800 && code <= 0xDFFF))
+    return 0xFFFD;
+  return code;
+}
+
 /**
 *  @brief: this draws a line on the frame buffer
 */
@@ -221,8 +815,9 @@ void Paint::DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t col
   int16_t sy = y0 < y1 ? 1 : -1;
   int16_t err = dx + dy;
 
+  MarkDirty(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0);
   while ((x0 != x1) || (y0 != y1)) {
-    DrawAbsolutePixel(x0, y0, colored);
+    SetAbsolutePixel(x0, y0, colored);
     if (2 * err >= dy && x0 != x1) {
       err += dy;
       x0 += sx;
@@ -238,20 +833,16 @@ void Paint::DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t col
 *  @brief: this draws a horizontal line on the frame buffer
 */
 void Paint::DrawHorizontalLine(int16_t x, int16_t y, int16_t line_width, int16_t colored) {
-  int16_t i;
-  for (i = x; i < x + line_width; i++) {
-    DrawPixel(i, y, colored);
-  }
+  if (line_width > 0)
+    FillRect(x, y, x + line_width - 1, y, colored);
 }
 
 /**
 *  @brief: this draws a vertical line on the frame buffer
 */
 void Paint::DrawVerticalLine(int16_t x, int16_t y, int16_t line_height, int16_t colored) {
-  int16_t i;
-  for (i = y; i < y + line_height; i++) {
-    DrawPixel(x, i, colored);
-  }
+  if (line_height > 0)
+    FillRect(x, y, x, y + line_height - 1, colored);
 }
 
 /**
@@ -274,16 +865,7 @@ void Paint::DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_
 *  @brief: this draws a filled rectangle
 */
 void Paint::DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
-  int16_t min_x, min_y, max_x, max_y;
-  int16_t i;
-  min_x = x1 > x0 ? x0 : x1;
-  max_x = x1 > x0 ? x1 : x0;
-  min_y = y1 > y0 ? y0 : y1;
-  max_y = y1 > y0 ? y1 : y0;
-
-  for (i = min_x; i <= max_x; i++) {
-    DrawVerticalLine(i, min_y, max_y - min_y + 1, colored);
-  }
+  FillRect(x0, y0, x1, y1, colored);
 }
 
 /**
@@ -325,10 +907,6 @@ void Paint::DrawFilledCircle(int16_t x, int16_t y, int16_t radius, int16_t color
   int16_t e2;
 
   do {
-    DrawPixel(x - x_pos, y + y_pos, colored);
-    DrawPixel(x + x_pos, y + y_pos, colored);
-    DrawPixel(x + x_pos, y - y_pos, colored);
-    DrawPixel(x - x_pos, y - y_pos, colored);
     DrawHorizontalLine(x + x_pos, y + y_pos, 2 * (-x_pos) + 1, colored);
     DrawHorizontalLine(x + x_pos, y - y_pos, 2 * (-x_pos) + 1, colored);
     e2 = err;
@@ -39,6 +39,37 @@ enum ORIENTATION {
 
 #include "fonts.h"
 
+// Number of separate dirty rectangles Paint tracks, further ones are merged
+#define PAINT_DIRTY_RECTS 4
+
+// Largest glyph of a proportional font (bytes with rows padded to whole
+// bytes) that's unpacked on the stack and blitted, bigger ones go by spans
+#define PAINT_GLYPH_BYTES 128
+
+// Changed area in absolute coordinates, corners included.
+// x0 and x1 + 1 are multiples of 8 so it maps onto whole image bytes.
+struct PaintRect {
+  int16_t x0;
+  int16_t y0;
+  int16_t x1;
+  int16_t y1;
+};
+
+// Up to PAINT_DIRTY_RECTS byte aligned rectangles, see PaintRegion::Add()
+class PaintRegion {
+public:
+  PaintRegion() : count(0) {}
+
+  void Add(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  inline void    Clear(void)                 { count = 0; }
+  inline uint8_t GetCount(void) const        { return count; }
+  inline const PaintRect& Get(uint8_t index) const { return rect[index]; }
+
+private:
+  PaintRect rect[PAINT_DIRTY_RECTS];
+  uint8_t   count;
+};
+
 class Paint {
 public:
   Paint(unsigned char* image, int16_t screenWidth, int16_t screenHeight, ORIENTATION orient = PORTRAIT, bool inverted = false);
@@ -53,11 +84,30 @@ public:
   bool isInverse(void);
   bool isInverse(bool invert);
   unsigned char* GetImage(void);
+  int16_t  GetStride(void);
+  bool     isDirty(void);
+  uint8_t  GetDirtyCount(void);
+  const PaintRect& GetDirtyRect(uint8_t index);
+  void     MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  void     ClearDirty(void);
+  // pixels written by the primitives, for profiling
+  inline uint32_t GetPixelCount(void)   { return pixels; }
+  inline void     ClearPixelCount(void) { pixels = 0; }
+  void     SetBand(int16_t top, int16_t rows);
   void TransformXY(int16_t* x, int16_t* y);
   void DrawAbsolutePixel(int16_t x, int16_t y, int16_t colored);
+  void FillAbsoluteRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
   void DrawPixel(int16_t x, int16_t y, int16_t colored);
   void DrawCharAt(int16_t x, int16_t y, char ascii_char, const sFONT* font, int16_t colored);
   void DrawStringAt(int16_t x, int16_t y, const char* text, const sFONT* font, int16_t colored);
+  void DrawCharAt(int16_t x, int16_t y, char ascii_char, const pFONT* font, int16_t colored);
+  void DrawStringAt(int16_t x, int16_t y, const char* text, const pFONT* font, int16_t colored);
+  void DrawStringAt(int16_t x, int16_t y, const char* text, uint16_t length, const pFONT* font, int16_t colored);
+  static int16_t GetStringWidth(const char* text, const pFONT* font);
+  static int16_t GetStringWidth(const char* text, uint16_t length, const pFONT* font);
+  static const pGLYPH* FindGlyph(const pFONT* font, uint16_t code);
+  static uint16_t NextCodePoint(const char** text);
+  void DrawBitmapAt(int16_t x, int16_t y, const unsigned char* bitmap, int16_t bitmap_width, int16_t bitmap_height, int16_t colored);
   void DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
   void DrawHorizontalLine(int16_t x, int16_t y, int16_t width, int16_t colored);
   void DrawVerticalLine(int16_t x, int16_t y, int16_t height, int16_t colored);
@@ -65,13 +115,36 @@ public:
   void DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
   void DrawCircle(int16_t x, int16_t y, int16_t radius, int16_t colored);
   void DrawFilledCircle(int16_t x, int16_t y, int16_t radius, int16_t colored);
+  static int32_t GetRotatedFontSize(const sFONT* font);
+  static bool    RotateFont(sFONT* font, uint8_t* buffer, int32_t size);
  
 private:
+  typedef void (Paint::*PixelWriter)(int16_t x, int16_t y, int16_t colored);
+  typedef void (Paint::*BitmapWriter)(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, int16_t colored);
+
+  template <ORIENTATION O> void Rotate(int16_t* x, int16_t* y);
+  template <ORIENTATION O> void DrawRotatedPixel(int16_t x, int16_t y, int16_t colored);
+  template <ORIENTATION O> void DrawRotatedBitmap(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, int16_t colored);
+  template <ORIENTATION O> void BlitBitmap(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, int16_t colored);
+  template <ORIENTATION O> void BlitColumns(int16_t x, int16_t y, const unsigned char* columns, int16_t w, int16_t h, int16_t colored);
+  template <bool MIRROR_X, bool MIRROR_Y> void BlitRows(int16_t x0, int16_t y0, const unsigned char* bitmap, int16_t w, int16_t h, int16_t colored);
+  void FillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
+  void WriteRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored);
+  int16_t DrawGlyph(int16_t x, int16_t y, uint16_t code, const pFONT* font, int16_t colored);
+  inline void SetAbsolutePixel(int16_t x, int16_t y, int16_t colored);
+
   unsigned char* image;
   int16_t        width;
   int16_t        height;
+  int16_t        bandTop;       // image holds rows bandTop..bandTop + bandRows - 1
+  int16_t        bandRows;
   ORIENTATION    orientation;
   bool           inverse;
+  PixelWriter    pixelWriter;   // bound by SetRotate()
+  BitmapWriter   bitmapWriter;
+  BitmapWriter   columnWriter;  // glyphs of rotated fonts, NULL where rows are image rows
+  PaintRegion    dirty;
+  uint32_t       pixels;
 };
 
 #endif
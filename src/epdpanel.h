@@ -0,0 +1,1073 @@
+/**
+ *  @filename   :   epdpanel.h
+ *  @brief      :   Common driver template for the tri-colour e-paper panels.
+ *                  Transport, partial windows and plane conversion live here
+ *                  once, the model specifics (resolution, pixel format,
+ *                  command set, LUTs) come from a traits struct, see
+ *                  epd1in54b.h ... epd7in5b.h
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDPANEL_H
+#define EPDPANEL_H
+
+#include "epdif.h"
+#include "epdpaint.h"
+#include "epddiff.h"
+#include "epddisplaylist.h"
+
+// Layout of the DATA_START_TRANSMISSION planes
+enum EPD_PIXEL_FORMAT {
+  EPD_1BPP,                 // 8 pixels per byte, one plane per colour
+  EPD_2BPP_BLACK,           // as EPD_1BPP but the black plane takes 2 bits per pixel
+  EPD_4BPP,                 // one plane, one nibble per pixel
+};
+
+// How a partial window is addressed
+enum EPD_WINDOW_FORMAT {
+  EPD_WINDOW_NONE,          // full frame updates only
+  EPD_WINDOW_X8,            // PARTIAL_IN/PARTIAL_WINDOW/PARTIAL_OUT, 8 bit x
+  EPD_WINDOW_X16,           // PARTIAL_IN/PARTIAL_WINDOW/PARTIAL_OUT, 16 bit x
+  EPD_WINDOW_PARTIAL_DTM,   // PARTIAL_DATA_START_TRANSMISSION_1/2 with window header
+};
+
+template <int FORMAT> struct EpdWindowTag {};
+
+// Waveform of the refreshes, see Panel::SetRefreshMode()
+enum EPD_REFRESH_MODE {
+  EPD_REFRESH_FULL,         // tri-colour waveform
+  EPD_REFRESH_FAST_BW,      // black/white only waveform while the red plane is unchanged
+};
+
+template <bool FAST_BW> struct EpdFastBwTag {};
+
+// Temperature assumed until ReadTemperature() or SetTemperature()
+#define EPD_TEMPERATURE_DEFAULT   20
+
+// Range the controller sensors are specified for, ReadTemperature()
+// takes anything outside as a bad read
+#define EPD_TEMPERATURE_MIN       -40
+#define EPD_TEMPERATURE_MAX       85
+
+// Reset and data timing every traits struct starts from, see Panel::Reset().
+// None of the controllers comes with a datasheet here, so there are no
+// per-controller minimums: the reset pulse and the wait before BUSY is
+// trusted are short, BUSY tells when the controller takes commands, and
+// SetConservativeTiming() falls back to the 200 ms of Waveshare's code.
+// A traits struct overrides a value only where its datasheet asks for more.
+struct EpdDefaultTiming {
+  enum {
+    RESET_LOW_MS   = 10,
+    RESET_READY_MS = 10,
+    DATA_GUARD_MS  = 0,
+  };
+};
+
+// Traits base of the tri-colour panels with the register LUTs 0x20 to 0x24,
+// the 2.9" and the 4.2": LUT_FAST is the waveform of Waveshare's black/white
+// 4.2" with red pixels left alone, see EPD_REFRESH_FAST_BW. It was made for
+// the 4.2" glass, on the 2.9" it is untested.
+struct EpdRegisterLutFastBw : EpdDefaultTiming {
+  static const unsigned char LUT_FAST[];
+};
+
+// Waveform settings of a temperature range, see Panel::SetTemperature()
+struct EpdTemperatureBand {
+  int8_t        minimum;        // lowest temperature of the band in degrees C
+  unsigned char frameRate;      // PLL_CONTROL for the band, 0 leaves it alone
+  uint16_t      refreshMs;      // expected tri-colour refresh
+  uint16_t      fastMs;         // expected black/white refresh, 0 if that waveform isn't safe
+};
+
+// Init and LUT scripts are byte arrays of records: a command, the number
+// of data bytes and the data, which goes out in one transfer. With
+// EPD_SCRIPT_WAIT in the count BUSY is waited for after the record.
+// EPD_SCRIPT_END takes the place of the command after the last record.
+#define EPD_SCRIPT_WAIT   0x80
+#define EPD_SCRIPT_END    0xFF
+
+// Worst case waits of SetConservativeTiming(), the reset pulse and the
+// time after it, and the pause around plane data
+#define EPD_CONSERVATIVE_RESET_MS   200
+#define EPD_CONSERVATIVE_GUARD_MS   2
+
+/**
+ *  A traits struct provides
+ *    enum { WIDTH, HEIGHT, RESOLUTION_IN_FRAME, CLEAR_BLACK, CLEAR_RED };
+ *    RESET_LOW_MS, RESET_READY_MS and DATA_GUARD_MS from EpdDefaultTiming;
+ *    static const EPD_PIXEL_FORMAT  PIXEL_FORMAT;
+ *    static const EPD_WINDOW_FORMAT WINDOW_FORMAT;
+ *  and the command set of the controller as an enum. The shared code uses
+ *  DATA_START_TRANSMISSION_1/2, DISPLAY_REFRESH and TCON_RESOLUTION, plus
+ *  the partial commands matching WINDOW_FORMAT. Init sequences and LUTs
+ *  are scripts, see EPD_SCRIPT_END.
+ *  With FAST_BW true it also provides the LUT scripts LUT (tri-colour) and
+ *  LUT_FAST (black/white, red pixels left alone) and LUT_FROM_REGISTER, the
+ *  PANEL_SETTING bit switching from the OTP to the register LUTs (0 if they
+ *  are always used).
+ *  TEMPERATURE_BANDS[TEMPERATURE_BAND_COUNT] lists the temperature bands of
+ *  the panel by rising minimum, the first one also covers anything colder.
+ */
+template <class Traits>
+class Panel : protected EpdIf, public Traits {
+public:
+  Panel()
+    : EpdIf(), _width(Traits::WIDTH), _height(Traits::HEIGHT)
+    , _panelSetting(0), _shadowBlack(NULL), _shadowRed(NULL), _shadowValid(0), _lut(NULL), _conservative(false)
+    , _refreshMode(EPD_REFRESH_FULL), _redSent(false)
+    , _temperature(EPD_TEMPERATURE_DEFAULT), _band(FindBand(EPD_TEMPERATURE_DEFAULT)), _frameRate(0)
+  { ResetPredictions(); }
+  Panel(SPIClass& hwSPI, int16_t pinCS, int16_t pinDC, int16_t pinReset, int16_t pinBusy)
+    : EpdIf(hwSPI, pinCS, pinDC, pinReset, pinBusy), _width(Traits::WIDTH), _height(Traits::HEIGHT)
+    , _panelSetting(0), _shadowBlack(NULL), _shadowRed(NULL), _shadowValid(0), _lut(NULL), _conservative(false)
+    , _refreshMode(EPD_REFRESH_FULL), _redSent(false)
+    , _temperature(EPD_TEMPERATURE_DEFAULT), _band(FindBand(EPD_TEMPERATURE_DEFAULT)), _frameRate(0)
+  { ResetPredictions(); }
+
+  void SendCommand(unsigned char command);
+  void SendData(unsigned char data, int16_t len = 1);
+  void SendData(const unsigned char *data, int16_t len);
+  void Reset(void);
+  bool SetPartialWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack = true, bool transmitRed = true);
+  bool SetPartialWindowBlack(const unsigned char* buffer_black, int16_t x, int16_t y, int16_t w, int16_t h);
+  bool SetPartialWindowRed(const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h);
+  bool SetPartialWindowAsync(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack = true, bool transmitRed = true);
+  bool DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red);
+  bool DisplayFrameAsync(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red);
+  bool DisplayFrame(DisplayList& black, DisplayList& red, unsigned char* band, int32_t band_bytes);
+  bool DisplayFrame(void);
+  bool ClearFrame(void);
+  bool Flush(Paint& black, Paint& red);
+  void SetShadow(unsigned char* shadow_black, unsigned char* shadow_red);
+  // worst case fixed waits instead of the panel timings and BUSY
+  inline void SetConservativeTiming(bool conservative) { _conservative = conservative; }
+  void SetRefreshMode(EPD_REFRESH_MODE mode);
+  inline EPD_REFRESH_MODE GetRefreshMode(void) { return _refreshMode; }
+  bool ReadTemperature(void);
+  void SetTemperature(int8_t celsius);
+  inline int8_t   GetTemperature(void)     { return _temperature; }
+  inline uint8_t  GetTemperatureBand(void) { return _band; }
+  uint16_t GetExpectedRefreshMs(void);
+  void ResetPredictions(void);
+
+  inline uint16_t GetWidth()   { return _width; }
+  inline uint16_t GetHeight()  { return _height; }
+  inline bool     isBusy(void) { return isPanelBusy(); }
+
+  using EpdIf::PollUpload;
+  using EpdIf::isUploadDone;
+  using EpdIf::Poll;
+  using EpdIf::GetState;
+  using EpdIf::WaitUntilIdle;
+  using EpdIf::SleepUntilIdle;
+  using EpdIf::AttachBusyInterrupt;
+  using EpdIf::DetachBusyInterrupt;
+  using EpdIf::GetRefreshStarted;
+  using EpdIf::GetRefreshCompleted;
+  using EpdIf::GetRefreshDuration;
+  using EpdIf::SetTrace;
+  using EpdIf::GetStats;
+  using EpdIf::ResetStats;
+
+protected:
+  bool    Wake(void);
+  void    DeepSleep(void);
+  void    RunScript(const unsigned char* script);
+  bool    LoadLut(const unsigned char* script);
+  inline bool isLutLoaded(void) { return _lut != NULL; }
+  void    SendPanelSetting(unsigned char setting);
+  inline void SelectWaveform(void) {
+    SelectFrameRate();
+    ExpectRefresh(&_predictMs[_band][isFastRefresh()]);
+    SelectWaveform(EpdFastBwTag<Traits::FAST_BW>());
+  }
+  inline bool isFastRefresh(void) {
+    return _refreshMode == EPD_REFRESH_FAST_BW && !_redSent && Traits::TEMPERATURE_BANDS[_band].fastMs != 0;
+  }
+  int16_t EncodeWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  int16_t EncodeResolution(void);
+  void    SendPlane(unsigned char command, const unsigned char* data, int32_t len, unsigned char fill);
+  void    SendPlaneData(const unsigned char* data, int32_t len, unsigned char fill);
+  void    SendExpandedPlane(const unsigned char* data, int32_t len, unsigned char fill);
+  void    SendWindowData(const unsigned char* data, int16_t w, int16_t h, int16_t stride, unsigned char fill);
+  inline int32_t PlaneBytes(void) { return (int32_t)_width * _height / 8; }
+  inline void    GuardDelay(void) {
+    uint16_t ms = _conservative ? EPD_CONSERVATIVE_GUARD_MS : Traits::DATA_GUARD_MS;
+    if (ms > 0) DelayMs(ms);
+  }
+
+  uint16_t      _width;
+  uint16_t      _height;
+  unsigned char _window[9];
+  unsigned char _panelSetting;  // as sent by SendPanelSetting()
+
+private:
+  enum { SHADOW_BLACK = 0x01, SHADOW_RED = 0x02 };
+
+  void TrackWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, int16_t stride, bool transmitBlack, bool transmitRed);
+  void TrackFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red);
+  template <int FORMAT>
+  void SendChanges(const unsigned char* data, const PaintRegion& changes, bool black, EpdWindowTag<FORMAT>);
+  void SendChanges(const unsigned char* data, const PaintRegion& changes, bool black, EpdWindowTag<EPD_WINDOW_NONE>);
+  template <int FORMAT>
+  void WriteWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, int16_t stride, bool transmitBlack, bool transmitRed, EpdWindowTag<FORMAT>);
+  void WriteWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, int16_t stride, bool transmitBlack, bool transmitRed, EpdWindowTag<EPD_WINDOW_PARTIAL_DTM>);
+  void FlushPlane(Paint& paint, bool black);
+  static uint8_t FindBand(int8_t celsius);
+  void SelectFrameRate(void);
+  void SelectWaveform(EpdFastBwTag<true>);
+  inline void SelectWaveform(EpdFastBwTag<false>) { _redSent = false; }
+  void RenderPlane(DisplayList& list, bool black, unsigned char* band, int16_t rows);
+  template <int FORMAT>
+  void QueueWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack, bool transmitRed, EpdWindowTag<FORMAT>);
+  void QueueWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack, bool transmitRed, EpdWindowTag<EPD_WINDOW_PARTIAL_DTM>);
+
+  unsigned char* _shadowBlack;
+  unsigned char* _shadowRed;
+  uint8_t        _shadowValid;  // SHADOW_BLACK/SHADOW_RED: shadow matches the panel SRAM
+  const unsigned char* _lut;    // LUT script resident in the controller, NULL if unknown
+  bool           _conservative;
+  EPD_REFRESH_MODE _refreshMode;
+  bool           _redSent;      // red plane data sent since the last refresh
+  int8_t         _temperature;
+  uint8_t        _band;         // index into TEMPERATURE_BANDS
+  unsigned char  _frameRate;    // PLL_CONTROL sent by SelectFrameRate(), 0 if unknown
+  uint16_t       _predictMs[Traits::TEMPERATURE_BAND_COUNT][2];  // by band, full/fast waveform
+};
+
+/**
+ *  @brief: basic function for sending commands
+ */
+template <class Traits>
+void Panel<Traits>::SendCommand(unsigned char command)
+{
+  DigitalWrite(_DC, LOW);
+  SpiTransfer(command, 1);
+}
+
+/**
+ *  @brief: basic function for sending data
+ */
+template <class Traits>
+void Panel<Traits>::SendData(unsigned char data, int16_t len)
+{
+  DigitalWrite(_DC, HIGH);
+  SpiTransfer(data, len);
+}
+
+/**
+ *  @brief: sends a whole block of data with one DC/CS cycle
+ */
+template <class Traits>
+void Panel<Traits>::SendData(const unsigned char *data, int16_t len)
+{
+  DigitalWrite(_DC, HIGH);
+  SpiTransfer(data, len);
+}
+
+/**
+ *  @brief: module reset.
+ *          often used to awaken the module in deep sleep,
+ *          see Epd::Sleep();
+ *          The pulse takes RESET_LOW_MS, after RESET_READY_MS the
+ *          controller holds BUSY until it takes commands.
+ */
+template <class Traits>
+void Panel<Traits>::Reset(void)
+{
+  DigitalWrite(_RST, LOW);
+  DelayMs(_conservative ? EPD_CONSERVATIVE_RESET_MS : Traits::RESET_LOW_MS);
+  DigitalWrite(_RST, HIGH);
+  _state = EPD_IDLE;
+  if (_conservative) {
+    DelayMs(EPD_CONSERVATIVE_RESET_MS);
+  }
+  else {
+    DelayMs(Traits::RESET_READY_MS);
+    WaitUntilIdle();
+  }
+  _shadowValid = 0;
+  _lut = NULL;
+  _frameRate = 0;
+}
+
+/**
+ *  @brief: brings the controller back for Init(). After a Sleep() that
+ *          only powered it off it still holds its registers, LUTs and
+ *          SRAM and just has to be idle, otherwise this is a Reset().
+ *          Returns whether the reset was skipped.
+ */
+template <class Traits>
+bool Panel<Traits>::Wake(void)
+{
+  if (_state == EPD_SLEEPING && _lut != NULL) {
+    _state = EPD_IDLE;            // so the power off is waited for
+    WaitUntilIdle();
+    return true;
+  }
+  Reset();
+  return false;
+}
+
+/**
+ *  @brief: sends the controller to deep sleep, only Reset() wakes it
+ *          and it loses its registers and LUTs on the way
+ */
+template <class Traits>
+void Panel<Traits>::DeepSleep(void)
+{
+  SendCommand(Traits::DEEP_SLEEP);
+  SendData(0xa5);                 // check code
+  _state = EPD_SLEEPING;
+  _lut = NULL;
+}
+
+/**
+ *  @brief: sends an init or LUT script, see EPD_SCRIPT_END
+ */
+template <class Traits>
+void Panel<Traits>::RunScript(const unsigned char* script)
+{
+  for (;;) {
+    unsigned char command = pgm_read_byte(script++);
+    if (command == EPD_SCRIPT_END) break;
+
+    unsigned char count = pgm_read_byte(script++);
+    int16_t len = count & ~EPD_SCRIPT_WAIT;
+    SendCommand(command);
+    if (len > 0) {
+      SendData(script, len);
+      script += len;
+    }
+    if (count & EPD_SCRIPT_WAIT) {
+      WaitUntilIdle();
+    }
+  }
+}
+
+/**
+ *  @brief: sends a LUT script unless the controller still holds it,
+ *          returns whether it was sent
+ */
+template <class Traits>
+bool Panel<Traits>::LoadLut(const unsigned char* script)
+{
+  if (_lut == script) return false;
+
+  RunScript(script);
+  _lut = script;
+  return true;
+}
+
+/**
+ *  @brief: sends PANEL_SETTING and keeps it for switching the LUT source,
+ *          see LUT_FROM_REGISTER
+ */
+template <class Traits>
+void Panel<Traits>::SendPanelSetting(unsigned char setting)
+{
+  _panelSetting = setting;
+  SendCommand(Traits::PANEL_SETTING);
+  SendData(setting);
+}
+
+/**
+ *  @brief: EPD_REFRESH_FAST_BW refreshes with a black/white only waveform,
+ *          which takes a fraction of the tri-colour one, as long as no
+ *          red data was sent since the last refresh. Send only the black
+ *          plane (red NULL) or use a shadow, see SetShadow(), to keep the
+ *          red plane from being sent. Any red data switches that refresh
+ *          back to the tri-colour waveform.
+ */
+template <class Traits>
+void Panel<Traits>::SetRefreshMode(EPD_REFRESH_MODE mode)
+{
+  static_assert(Traits::FAST_BW, "this panel has no black/white waveform");
+
+  _refreshMode = mode;
+}
+
+/**
+ *  @brief: reads the temperature sensor of the controller and picks the
+ *          band for the next refreshes, see SetTemperature(). The
+ *          controller has to be awake, and its DIN has to be wired for
+ *          reading, see SpiReceive(). Without a plausible reading it
+ *          returns false and the band stays: all ones or all zeros are
+ *          what a MISO left floating or pulled reads, and so is anything
+ *          outside EPD_TEMPERATURE_MIN to EPD_TEMPERATURE_MAX.
+ */
+template <class Traits>
+bool Panel<Traits>::ReadTemperature(void)
+{
+  unsigned char value[2];
+
+  if (_state == EPD_SLEEPING) return false;
+
+  WaitUntilIdle();
+  SendCommand(Traits::TEMPERATURE_SENSOR_COMMAND);
+  WaitUntilIdle();
+  DigitalWrite(_DC, HIGH);
+  SpiReceive(value, 2);
+  if (value[0] == 0xFF && value[1] == 0xFF) return false;   // nothing drives DIN
+  if (value[0] == 0x00 && value[1] == 0x00) return false;   // or MISO is pulled down
+
+  int8_t celsius = (int8_t)value[0];   // whole degrees, value[1] holds the fraction
+  if (celsius < EPD_TEMPERATURE_MIN || celsius > EPD_TEMPERATURE_MAX) return false;
+  SetTemperature(celsius);
+  return true;
+}
+
+/**
+ *  @brief: picks the band of TEMPERATURE_BANDS for the next refreshes,
+ *          for a temperature measured elsewhere. Cold bands slow the frame
+ *          rate down and rule the black/white waveform out.
+ */
+template <class Traits>
+void Panel<Traits>::SetTemperature(int8_t celsius)
+{
+  _temperature = celsius;
+  _band = FindBand(celsius);
+}
+
+template <class Traits>
+uint8_t Panel<Traits>::FindBand(int8_t celsius)
+{
+  uint8_t band = 0;
+
+  while (band + 1 < Traits::TEMPERATURE_BAND_COUNT && celsius >= Traits::TEMPERATURE_BANDS[band + 1].minimum) {
+    band++;
+  }
+  return band;
+}
+
+/**
+ *  @brief: how long the next refresh is expected to take in the current
+ *          band, with the waveform it would use. Starts out from
+ *          TEMPERATURE_BANDS and learns from every refresh that drove
+ *          BUSY, the accuracy is kept in GetStats().
+ */
+template <class Traits>
+uint16_t Panel<Traits>::GetExpectedRefreshMs(void)
+{
+  return _predictMs[_band][isFastRefresh()];
+}
+
+/**
+ *  @brief: forgets the learned refresh durations, e.g. after swapping
+ *          the panel
+ */
+template <class Traits>
+void Panel<Traits>::ResetPredictions(void)
+{
+  for (uint8_t band = 0; band < Traits::TEMPERATURE_BAND_COUNT; band++) {
+    const EpdTemperatureBand& entry = Traits::TEMPERATURE_BANDS[band];
+
+    _predictMs[band][0] = entry.refreshMs;
+    _predictMs[band][1] = entry.fastMs != 0 ? entry.fastMs : entry.refreshMs;
+  }
+}
+
+/**
+ *  @brief: sends the frame rate of the band if it changed
+ */
+template <class Traits>
+void Panel<Traits>::SelectFrameRate(void)
+{
+  unsigned char rate = Traits::TEMPERATURE_BANDS[_band].frameRate;
+
+  if (rate != 0 && rate != _frameRate) {
+    SendCommand(Traits::PLL_CONTROL);
+    SendData(rate);
+    _frameRate = rate;
+  }
+}
+
+/**
+ *  @brief: loads the waveform for the refresh about to start, called
+ *          right before the refresh command
+ */
+template <class Traits>
+void Panel<Traits>::SelectWaveform(EpdFastBwTag<true>)
+{
+  bool fast = isFastRefresh();
+  const unsigned char* lut = fast ? Traits::LUT_FAST : Traits::LUT;
+
+  if (_lut != lut && Traits::LUT_FROM_REGISTER != 0) {
+    SendCommand(Traits::PANEL_SETTING);
+    SendData(fast ? _panelSetting | Traits::LUT_FROM_REGISTER : _panelSetting & ~Traits::LUT_FROM_REGISTER);
+  }
+  LoadLut(lut);
+  _redSent = false;
+}
+
+/**
+ *  @brief: fills in the partial window header for the WINDOW_FORMAT of
+ *          the panel, returns its length
+ */
+template <class Traits>
+int16_t Panel<Traits>::EncodeWindow(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  unsigned char* p = _window;
+
+  // x should be the multiple of 8, the last 3 bit will always be ignored
+  switch (Traits::WINDOW_FORMAT) {
+    case EPD_WINDOW_X8:
+      *p++ = (x & 0xf8);
+      *p++ = (((x & 0xf8) + w - 1) | 0x07);
+      break;
+    case EPD_WINDOW_X16:
+      *p++ = (x >> 8);
+      *p++ = (x & 0xf8);
+      *p++ = (((x & 0x1f8) + w - 1) >> 8);
+      *p++ = (((x & 0x1f8) + w - 1) | 0x07);
+      break;
+    case EPD_WINDOW_PARTIAL_DTM:
+      *p++ = (x >> 8);
+      *p++ = (x & 0xf8);
+      *p++ = (y >> 8);
+      *p++ = (y & 0xff);
+      *p++ = (w >> 8);
+      *p++ = (w & 0xf8);  // w (width) should be the multiple of 8 as well
+      *p++ = (h >> 8);
+      *p++ = (h & 0xff);
+      return p - _window;
+    default:
+      return 0;
+  }
+  *p++ = (y >> 8);
+  *p++ = (y & 0xff);
+  *p++ = ((y + h - 1) >> 8);
+  *p++ = ((y + h - 1) & 0xff);
+  *p++ = (0x01);          // Gates scan both inside and outside of the partial window. (default)
+  return p - _window;
+}
+
+/**
+ *  @brief: fills in the 4 byte TCON_RESOLUTION data, returns its length
+ */
+template <class Traits>
+int16_t Panel<Traits>::EncodeResolution(void)
+{
+  _window[0] = (_width >> 8);
+  _window[1] = (_width & 0xff);
+  _window[2] = (_height >> 8);
+  _window[3] = (_height & 0xff);
+  return 4;
+}
+
+/**
+ *  @brief: streams plane data of any length, data == NULL sends len
+ *          copies of fill instead
+ */
+template <class Traits>
+void Panel<Traits>::SendPlaneData(const unsigned char* data, int32_t len, unsigned char fill)
+{
+  DigitalWrite(_DC, HIGH);
+  while (len > 0) {
+    int16_t chunk = len > 0x4000 ? 0x4000 : len;
+    if (data != NULL) {
+      SpiTransfer(data, chunk);
+      data += chunk;
+    }
+    else {
+      SpiTransfer(fill, chunk);
+    }
+    len -= chunk;
+  }
+}
+
+/**
+ *  @brief: sends the w x h window data, rows are stride bytes apart in
+ *          data. data == NULL fills the window with fill.
+ */
+template <class Traits>
+void Panel<Traits>::SendWindowData(const unsigned char* data, int16_t w, int16_t h, int16_t stride, unsigned char fill)
+{
+  if (data == NULL || stride == w / 8) {
+    SendPlaneData(data, (int32_t)w / 8 * h, fill);
+    return;
+  }
+  DigitalWrite(_DC, HIGH);
+  for (; h > 0; h--, data += stride) {
+    SpiTransfer(data, w / 8);
+  }
+}
+
+/**
+ *  @brief: the EPD_2BPP_BLACK plane takes 2 bits per pixel, this expands
+ *          one nibble of a 1bpp source byte into the matching output byte
+ */
+static const unsigned char epd_expand_nibble[16] = {
+  0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+  0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+
+template <class Traits>
+void Panel<Traits>::SendExpandedPlane(const unsigned char* data, int32_t len, unsigned char fill)
+{
+  unsigned char temp[64];
+
+  if (data == NULL) {
+    SendPlaneData(NULL, 2 * len, fill);
+    return;
+  }
+  while (len > 0) {
+    int16_t n = 0;
+    for (; n < (int16_t)sizeof(temp) && len > 0; len--) {
+      unsigned char src = pgm_read_byte(data++);
+      temp[n++] = epd_expand_nibble[src >> 4];
+      temp[n++] = epd_expand_nibble[src & 0x0F];
+    }
+    SendData(temp, n);
+  }
+}
+
+/**
+ *  @brief: sends one full plane with its command
+ */
+template <class Traits>
+void Panel<Traits>::SendPlane(unsigned char command, const unsigned char* data, int32_t len, unsigned char fill)
+{
+  NotePlane();
+  if (command == Traits::DATA_START_TRANSMISSION_2) _redSent = true;
+  SendCommand(command);
+  GuardDelay();
+  if (Traits::PIXEL_FORMAT == EPD_2BPP_BLACK && command == Traits::DATA_START_TRANSMISSION_1) {
+    SendExpandedPlane(data, len, fill);
+  }
+  else {
+    SendPlaneData(data, len, fill);
+  }
+  GuardDelay();
+}
+
+/**
+ *  @brief: transmit partial data to the SRAM,
+ *          a NULL buffer clears its part of the window to CLEAR_BLACK or CLEAR_RED
+ */
+template <class Traits>
+bool Panel<Traits>::SetPartialWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack, bool transmitRed)
+{
+  static_assert(Traits::WINDOW_FORMAT != EPD_WINDOW_NONE, "this panel has no partial window");
+
+  WaitUntilIdle();
+  WriteWindow(buffer_black, buffer_red, x, y, w, h, w / 8, transmitBlack, transmitRed, EpdWindowTag<Traits::WINDOW_FORMAT>());
+  return true;
+}
+
+template <class Traits>
+template <int FORMAT>
+void Panel<Traits>::WriteWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, int16_t stride, bool transmitBlack, bool transmitRed, EpdWindowTag<FORMAT>)
+{
+  TrackWindow(buffer_black, buffer_red, x, y, w, h, stride, transmitBlack, transmitRed);
+  NoteWindow();
+  _redSent |= transmitRed;
+
+  SendCommand(Traits::PARTIAL_IN);
+  SendCommand(Traits::PARTIAL_WINDOW);
+  SendData(_window, EncodeWindow(x, y, w, h));
+  GuardDelay();
+
+  if (transmitBlack) {
+    SendCommand(Traits::DATA_START_TRANSMISSION_1);
+    SendWindowData(buffer_black, w, h, stride, Traits::CLEAR_BLACK);
+    GuardDelay();
+  }
+  if (transmitRed) {
+    SendCommand(Traits::DATA_START_TRANSMISSION_2);
+    SendWindowData(buffer_red, w, h, stride, Traits::CLEAR_RED);
+    GuardDelay();
+  }
+  SendCommand(Traits::PARTIAL_OUT);
+}
+
+template <class Traits>
+void Panel<Traits>::WriteWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, int16_t stride, bool transmitBlack, bool transmitRed, EpdWindowTag<EPD_WINDOW_PARTIAL_DTM>)
+{
+  int16_t header = EncodeWindow(x, y, w, h);
+
+  TrackWindow(buffer_black, buffer_red, x, y, w, h, stride, transmitBlack, transmitRed);
+  NoteWindow();
+  _redSent |= transmitRed;
+
+  if (transmitBlack) {
+    SendCommand(Traits::PARTIAL_DATA_START_TRANSMISSION_1);
+    SendData(_window, header);
+    GuardDelay();
+    SendWindowData(buffer_black, w, h, stride, Traits::CLEAR_BLACK);
+    GuardDelay();
+  }
+  if (transmitRed) {
+    SendCommand(Traits::PARTIAL_DATA_START_TRANSMISSION_2);
+    SendData(_window, header);
+    GuardDelay();
+    SendWindowData(buffer_red, w, h, stride, Traits::CLEAR_RED);
+    GuardDelay();
+  }
+}
+
+/**
+ *  @brief: transmit partial data to the black part of SRAM
+ */
+template <class Traits>
+bool Panel<Traits>::SetPartialWindowBlack(const unsigned char* buffer_black, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  return SetPartialWindow(buffer_black, NULL, x, y, w, h, true, false);
+}
+
+/**
+ *  @brief: transmit partial data to the red part of SRAM
+ */
+template <class Traits>
+bool Panel<Traits>::SetPartialWindowRed(const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  return SetPartialWindow(NULL, buffer_red, x, y, w, h, false, true);
+}
+
+/**
+ *  @brief: same as SetPartialWindow() but the buffers are streamed by DMA,
+ *          returns immediately. Drive the upload with Poll() and keep
+ *          the buffers alive until isUploadDone().
+ */
+template <class Traits>
+bool Panel<Traits>::SetPartialWindowAsync(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack, bool transmitRed)
+{
+  static_assert(Traits::WINDOW_FORMAT != EPD_WINDOW_NONE, "this panel has no partial window");
+
+  if (Poll() != EPD_IDLE || isBusy()) return false;
+
+  QueueWindow(buffer_black, buffer_red, x, y, w, h, transmitBlack, transmitRed, EpdWindowTag<Traits::WINDOW_FORMAT>());
+  TrackWindow(buffer_black, buffer_red, x, y, w, h, w / 8, transmitBlack, transmitRed);
+  NoteWindow();
+  _redSent |= transmitRed;
+  return StartUpload();
+}
+
+template <class Traits>
+template <int FORMAT>
+void Panel<Traits>::QueueWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack, bool transmitRed, EpdWindowTag<FORMAT>)
+{
+  QueuePhase(Traits::PARTIAL_IN);
+  QueuePhase(Traits::PARTIAL_WINDOW, _window, EncodeWindow(x, y, w, h));
+  if (transmitBlack) {
+    QueuePhase(Traits::DATA_START_TRANSMISSION_1, buffer_black, w / 8 * h, Traits::CLEAR_BLACK);
+  }
+  if (transmitRed) {
+    QueuePhase(Traits::DATA_START_TRANSMISSION_2, buffer_red, w / 8 * h, Traits::CLEAR_RED);
+  }
+  QueuePhase(Traits::PARTIAL_OUT);
+}
+
+template <class Traits>
+void Panel<Traits>::QueueWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, bool transmitBlack, bool transmitRed, EpdWindowTag<EPD_WINDOW_PARTIAL_DTM>)
+{
+  int16_t header = EncodeWindow(x, y, w, h);
+
+  if (transmitBlack) {
+    QueuePhase(Traits::PARTIAL_DATA_START_TRANSMISSION_1, _window, header);
+    QueuePhase(EPDIF_DATA_ONLY, buffer_black, w / 8 * h, Traits::CLEAR_BLACK);
+  }
+  if (transmitRed) {
+    QueuePhase(Traits::PARTIAL_DATA_START_TRANSMISSION_2, _window, header);
+    QueuePhase(EPDIF_DATA_ONLY, buffer_red, w / 8 * h, Traits::CLEAR_RED);
+  }
+}
+
+/**
+ * @brief: transmits the planes and starts the refresh, returns as soon as
+ *         the refresh is running, see Poll()
+ *         With a shadow (see SetShadow()) only the changed parts of a plane
+ *         are sent, if neither plane changed it returns false and the
+ *         refresh is skipped.
+ */
+template <class Traits>
+bool Panel<Traits>::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red)
+{
+  PaintRegion changedBlack;
+  PaintRegion changedRed;
+  bool fullBlack = frame_buffer_black != NULL;
+  bool fullRed = frame_buffer_red != NULL;
+
+  WaitUntilIdle();
+
+  if (fullBlack && _shadowBlack != NULL && (_shadowValid & SHADOW_BLACK)) {
+    EpdDiffPlane(frame_buffer_black, _shadowBlack, _width / 8, _height, changedBlack);
+    fullBlack = false;
+  }
+  if (fullRed && _shadowRed != NULL && (_shadowValid & SHADOW_RED)) {
+    EpdDiffPlane(frame_buffer_red, _shadowRed, _width / 8, _height, changedRed);
+    fullRed = false;
+  }
+  if (!fullBlack && !fullRed && !changedBlack.GetCount() && !changedRed.GetCount()) {
+    return false;
+  }
+
+  if (Traits::RESOLUTION_IN_FRAME && (fullBlack || fullRed)) {
+    SendCommand(Traits::TCON_RESOLUTION);
+    SendData(_window, EncodeResolution());
+  }
+  if (fullBlack) {
+    SendPlane(Traits::DATA_START_TRANSMISSION_1, frame_buffer_black, PlaneBytes(), Traits::CLEAR_BLACK);
+  }
+  if (fullRed) {
+    SendPlane(Traits::DATA_START_TRANSMISSION_2, frame_buffer_red, PlaneBytes(), Traits::CLEAR_RED);
+  }
+  TrackFrame(fullBlack ? frame_buffer_black : NULL, fullRed ? frame_buffer_red : NULL);
+  SendChanges(frame_buffer_black, changedBlack, true, EpdWindowTag<Traits::WINDOW_FORMAT>());
+  SendChanges(frame_buffer_red, changedRed, false, EpdWindowTag<Traits::WINDOW_FORMAT>());
+  SelectWaveform();
+  SendCommand(Traits::DISPLAY_REFRESH);
+  BeginRefresh();
+
+  return true;
+}
+
+/**
+ *  @brief: sends the changed rectangles of a plane as partial windows
+ */
+template <class Traits>
+template <int FORMAT>
+void Panel<Traits>::SendChanges(const unsigned char* data, const PaintRegion& changes, bool black, EpdWindowTag<FORMAT>)
+{
+  int16_t stride = _width / 8;
+
+  for (uint8_t i = 0; i < changes.GetCount(); i++) {
+    const PaintRect& r = changes.Get(i);
+    const unsigned char* window = data + r.y0 * stride + r.x0 / 8;
+    WriteWindow(black ? window : NULL, black ? NULL : window, r.x0, r.y0, r.x1 - r.x0 + 1, r.y1 - r.y0 + 1, stride, black, !black, EpdWindowTag<FORMAT>());
+  }
+}
+
+/**
+ *  @brief: without partial windows a changed plane is sent whole
+ */
+template <class Traits>
+void Panel<Traits>::SendChanges(const unsigned char* data, const PaintRegion& changes, bool black, EpdWindowTag<EPD_WINDOW_NONE>)
+{
+  if (!changes.GetCount()) return;
+
+  SendPlane(black ? Traits::DATA_START_TRANSMISSION_1 : Traits::DATA_START_TRANSMISSION_2, data, PlaneBytes(), black ? Traits::CLEAR_BLACK : Traits::CLEAR_RED);
+  TrackFrame(black ? data : NULL, black ? NULL : data);
+}
+
+/**
+ *  @brief: keeps the shadow planes in step with a window sent to the panel,
+ *          a window outside the panel leaves that shadow unknown
+ */
+template <class Traits>
+void Panel<Traits>::TrackWindow(const unsigned char* buffer_black, const unsigned char* buffer_red, int16_t x, int16_t y, int16_t w, int16_t h, int16_t stride, bool transmitBlack, bool transmitRed)
+{
+  bool inside = x >= 0 && y >= 0 && (x & ~7) + w <= _width && y + h <= _height;
+
+  if (transmitBlack && _shadowBlack != NULL) {
+    if (inside) EpdCopyWindow(_shadowBlack, _width / 8, x, y, w, h, buffer_black, stride, Traits::CLEAR_BLACK);
+    else _shadowValid &= ~SHADOW_BLACK;
+  }
+  if (transmitRed && _shadowRed != NULL) {
+    if (inside) EpdCopyWindow(_shadowRed, _width / 8, x, y, w, h, buffer_red, stride, Traits::CLEAR_RED);
+    else _shadowValid &= ~SHADOW_RED;
+  }
+}
+
+/**
+ *  @brief: records whole planes sent to the panel in the shadows
+ */
+template <class Traits>
+void Panel<Traits>::TrackFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red)
+{
+  if (frame_buffer_black != NULL && _shadowBlack != NULL) {
+    memcpy(_shadowBlack, frame_buffer_black, PlaneBytes());
+    _shadowValid |= SHADOW_BLACK;
+  }
+  if (frame_buffer_red != NULL && _shadowRed != NULL) {
+    memcpy(_shadowRed, frame_buffer_red, PlaneBytes());
+    _shadowValid |= SHADOW_RED;
+  }
+}
+
+/**
+ *  @brief: sets optional buffers of GetWidth() * GetHeight() / 8 bytes each
+ *          that mirror the planes in the panel SRAM, so DisplayFrame() can
+ *          send only what changed. Either can be NULL. The mirror is only
+ *          trusted after a whole plane was sent or cleared.
+ */
+template <class Traits>
+void Panel<Traits>::SetShadow(unsigned char* shadow_black, unsigned char* shadow_red)
+{
+  static_assert(Traits::PIXEL_FORMAT != EPD_4BPP, "planes of this panel can't be shadowed");
+
+  _shadowBlack = shadow_black;
+  _shadowRed = shadow_red;
+  _shadowValid = 0;
+}
+
+/**
+ *  @brief: same as DisplayFrame() but the planes are streamed by DMA and
+ *          the refresh is started once they are sent, returns immediately.
+ */
+template <class Traits>
+bool Panel<Traits>::DisplayFrameAsync(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red)
+{
+  static_assert(Traits::PIXEL_FORMAT == EPD_1BPP, "planes of this panel need converting, use DisplayFrame()");
+
+  if (Poll() != EPD_IDLE || isBusy()) return false;
+
+  if (Traits::RESOLUTION_IN_FRAME) {
+    QueuePhase(Traits::TCON_RESOLUTION, _window, EncodeResolution());
+  }
+  if (frame_buffer_black != NULL) {
+    QueuePhase(Traits::DATA_START_TRANSMISSION_1, frame_buffer_black, PlaneBytes());
+  }
+  if (frame_buffer_red != NULL) {
+    QueuePhase(Traits::DATA_START_TRANSMISSION_2, frame_buffer_red, PlaneBytes());
+  }
+  QueueRefresh(Traits::DISPLAY_REFRESH);
+  TrackFrame(frame_buffer_black, frame_buffer_red);
+  NotePlane();
+  _redSent |= frame_buffer_red != NULL;
+  SelectWaveform();
+  return StartUpload();
+}
+
+/**
+ * @brief: clear the frame data from the SRAM, this won't refresh the display
+ */
+template <class Traits>
+bool Panel<Traits>::ClearFrame(void)
+{
+  WaitUntilIdle();
+
+  if (Traits::RESOLUTION_IN_FRAME) {
+    SendCommand(Traits::TCON_RESOLUTION);
+    SendData(_window, EncodeResolution());
+  }
+  SendPlane(Traits::DATA_START_TRANSMISSION_1, NULL, PlaneBytes(), Traits::CLEAR_BLACK);
+  SendPlane(Traits::DATA_START_TRANSMISSION_2, NULL, PlaneBytes(), Traits::CLEAR_RED);
+  if (_shadowBlack != NULL) {
+    memset(_shadowBlack, Traits::CLEAR_BLACK, PlaneBytes());
+    _shadowValid |= SHADOW_BLACK;
+  }
+  if (_shadowRed != NULL) {
+    memset(_shadowRed, Traits::CLEAR_RED, PlaneBytes());
+    _shadowValid |= SHADOW_RED;
+  }
+
+  return true;
+}
+
+/**
+ * @brief: uploads only what was drawn since the last flush, one partial
+ *         window per dirty rectangle of each plane, and starts the
+ *         refresh. Both Paints have to cover the whole panel unrotated
+ *         in memory. Returns false without refreshing if nothing changed.
+ */
+template <class Traits>
+bool Panel<Traits>::Flush(Paint& black, Paint& red)
+{
+  static_assert(Traits::WINDOW_FORMAT != EPD_WINDOW_NONE, "this panel has no partial window, use DisplayFrame()");
+
+  if (!black.isDirty() && !red.isDirty()) return false;
+
+  WaitUntilIdle();
+  FlushPlane(black, true);
+  FlushPlane(red, false);
+  SelectWaveform();
+  SendCommand(Traits::DISPLAY_REFRESH);
+  BeginRefresh();
+
+  return true;
+}
+
+template <class Traits>
+void Panel<Traits>::FlushPlane(Paint& paint, bool black)
+{
+  int16_t stride = paint.GetStride();
+
+  for (uint8_t i = 0; i < paint.GetDirtyCount(); i++) {
+    const PaintRect& r = paint.GetDirtyRect(i);
+    const unsigned char* data = paint.GetImage() + r.y0 * stride + r.x0 / 8;
+    int16_t w = r.x1 - r.x0 + 1;
+    int16_t h = r.y1 - r.y0 + 1;
+    WriteWindow(black ? data : NULL, black ? NULL : data, r.x0, r.y0, w, h, stride, black, !black, EpdWindowTag<Traits::WINDOW_FORMAT>());
+  }
+  paint.ClearDirty();
+}
+
+/**
+ * @brief: renders the display lists one band of rows at a time into band
+ *         and streams each band to the panel, so no frame buffer is
+ *         needed. band_bytes should hold several rows of GetWidth() / 8
+ *         bytes, fewer bands mean fewer replays of the lists.
+ */
+template <class Traits>
+bool Panel<Traits>::DisplayFrame(DisplayList& black, DisplayList& red, unsigned char* band, int32_t band_bytes)
+{
+  static_assert(Traits::PIXEL_FORMAT != EPD_4BPP, "this panel can't be rendered in bands");
+
+  int32_t rows = band_bytes / (_width / 8);
+
+  if (rows < 1) return false;
+  if (rows > _height) rows = _height;
+
+  WaitUntilIdle();
+
+  if (Traits::RESOLUTION_IN_FRAME) {
+    SendCommand(Traits::TCON_RESOLUTION);
+    SendData(_window, EncodeResolution());
+  }
+  RenderPlane(black, true, band, rows);
+  RenderPlane(red, false, band, rows);
+  SelectWaveform();
+  SendCommand(Traits::DISPLAY_REFRESH);
+  BeginRefresh();
+
+  return true;
+}
+
+template <class Traits>
+void Panel<Traits>::RenderPlane(DisplayList& list, bool black, unsigned char* band, int16_t rows)
+{
+  Paint paint(band, _width, _height, list.GetRotate(), list.isInverse());
+  int16_t stride = _width / 8;
+
+  NotePlane();
+  _redSent |= !black;
+  SendCommand(black ? Traits::DATA_START_TRANSMISSION_1 : Traits::DATA_START_TRANSMISSION_2);
+  GuardDelay();
+  for (int16_t top = 0; top < _height; top += rows) {
+    int16_t n = _height - top < rows ? _height - top : rows;
+
+    paint.SetBand(top, n);
+    memset(band, black ? Traits::CLEAR_BLACK : Traits::CLEAR_RED, (int32_t)n * stride);
+    list.Replay(paint);
+    if (Traits::PIXEL_FORMAT == EPD_2BPP_BLACK && black) {
+      SendExpandedPlane(band, (int32_t)n * stride, Traits::CLEAR_BLACK);
+    }
+    else {
+      SendPlaneData(band, (int32_t)n * stride, black ? Traits::CLEAR_BLACK : Traits::CLEAR_RED);
+    }
+    TrackWindow(black ? band : NULL, black ? NULL : band, 0, top, _width, n, stride, black, !black);
+  }
+  GuardDelay();
+  _shadowValid |= black ? (_shadowBlack != NULL ? SHADOW_BLACK : 0) : (_shadowRed != NULL ? SHADOW_RED : 0);
+}
+
+/**
+ * @brief: This displays the frame data from SRAM
+ */
+template <class Traits>
+bool Panel<Traits>::DisplayFrame(void)
+{
+  WaitUntilIdle();
+
+  SelectWaveform();
+  SendCommand(Traits::DISPLAY_REFRESH);
+  BeginRefresh();
+
+  return true;
+}
+
+#endif /* EPDPANEL_H */
+
+/* END OF FILE */
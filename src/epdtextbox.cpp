@@ -0,0 +1,295 @@
+/**
+ *  @filename   :   epdtextbox.cpp
+ *  @brief      :   Text layout in a box, see epdtextbox.h
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <avr/pgmspace.h>
+#include "epdtextbox.h"
+
+TextBox::TextBox(const pFONT* font, int16_t width, int16_t height, TEXT_ALIGN align, bool wrap)
+  : font(NULL), width(width), height(height), align(align), wrap(wrap), layouts(0)
+{
+  SetFont(font);
+}
+
+/**
+ *  @brief: picks the ellipsis the font can draw, the cached layouts are
+ *          dropped as the advances change
+ */
+void TextBox::SetFont(const pFONT* font)
+{
+  const pGLYPH* glyph = Paint::FindGlyph(font, 0x2026);
+
+  this->font = font;
+  if (glyph != NULL && (font->Fallback == 0 || glyph != Paint::FindGlyph(font, font->Fallback)))
+    ellipsis = "\xE2\x80\xA6";
+  else
+    ellipsis = "...";
+  ellipsisWidth = Paint::GetStringWidth(ellipsis, font);
+  ClearCache();
+}
+
+void TextBox::SetSize(int16_t width, int16_t height)
+{
+  if (width == this->width && height == this->height)
+    return;
+  this->width = width;
+  this->height = height;
+  ClearCache();
+}
+
+void TextBox::SetWrap(bool wrap)
+{
+  if (wrap == this->wrap)
+    return;
+  this->wrap = wrap;
+  ClearCache();
+}
+
+void TextBox::ClearCache(void)
+{
+  for (uint8_t i = 0; i < TEXTBOX_CACHE; i++)
+    cache[i].count = 0;
+  current = 0;
+  next = 0;
+}
+
+/**
+ *  @brief: FNV-1a of the text, which with its length keys the cache
+ */
+uint32_t TextBox::Hash(const char* text, uint16_t* bytes)
+{
+  uint32_t hash = 2166136261u;
+  const char* p = text;
+
+  for (; *p != 0; p++)
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+  *bytes = p - text;
+  return hash;
+}
+
+int16_t TextBox::GetAdvance(uint16_t code)
+{
+  const pGLYPH* glyph = Paint::FindGlyph(font, code);
+  return glyph != NULL ? pgm_read_byte(&glyph->XAdvance) : 0;
+}
+
+/**
+ *  @brief: lays the text out, or finds the layout of the same text in the
+ *          cache, and returns its line count
+ */
+uint8_t TextBox::Layout(const char* text)
+{
+  uint16_t bytes;
+  uint32_t hash = Hash(text, &bytes);
+
+  for (uint8_t i = 0; i < TEXTBOX_CACHE; i++) {
+    if (cache[i].count != 0 && cache[i].hash == hash && cache[i].bytes == bytes) {
+      current = i;
+      return cache[i].count;
+    }
+  }
+
+  current = next;
+  next = (next + 1) % TEXTBOX_CACHE;
+  CachedLayout& layout = cache[current];
+  layout.hash = hash;
+  layout.bytes = bytes;
+  Compute(layout, text);
+  layouts++;
+  return layout.count;
+}
+
+/**
+ *  @brief: line of the last Layout() or Draw()
+ */
+const TextLine& TextBox::GetLine(uint8_t index)
+{
+  return cache[current].line[index];
+}
+
+int16_t TextBox::GetTextHeight(const char* text)
+{
+  return Layout(text) * font->Height;
+}
+
+/**
+ *  @brief: greedy line breaking, each line takes as many words as fit.
+ *          Spaces at a break are dropped, text left over when the lines
+ *          run out ends the last one in an ellipsis.
+ */
+void TextBox::Compute(CachedLayout& layout, const char* text)
+{
+  int16_t max_lines = font->Height > 0 ? height / font->Height : 1;
+  int16_t space_advance = GetAdvance(' ');
+  const char* p = text;
+
+  if (max_lines < 1) max_lines = 1;
+  if (max_lines > TEXTBOX_LINES) max_lines = TEXTBOX_LINES;
+
+  layout.count = 0;
+  while (*p != 0 && layout.count < max_lines) {
+    TextLine& line = layout.line[layout.count++];
+    const char* start = p;
+    const char* end;
+    const char* space = NULL;   // last space the line can end at
+    int16_t space_width = 0;
+    int16_t line_width = 0;
+
+    for (const char* q = p; ; ) {
+      if (*q == 0 || *q == '\n') {
+        end = q;
+        p = *q != 0 ? q + 1 : q;
+        break;
+      }
+      const char* after = q;
+      uint16_t code = Paint::NextCodePoint(&after);
+      int16_t advance = GetAdvance(code);
+      if (code == ' ') {
+        space = q;
+        space_width = line_width;
+      }
+      else if (wrap && line_width + advance > width) {
+        if (space != NULL) {
+          end = space;
+          line_width = space_width;
+        }
+        else if (q > start) {
+          end = q;
+        }
+        else {
+          end = after;                  // a glyph wider than the box
+          line_width = advance;
+        }
+        for (p = end; *p == ' '; p++);
+        break;
+      }
+      line_width += advance;
+      q = after;
+    }
+
+    while (end > start && end[-1] == ' ') {
+      end--;
+      line_width -= space_advance;
+    }
+    line.start = start - text;
+    line.length = end - start;
+    line.width = line_width;
+    line.ellipsis = false;
+    if (!wrap && line_width > width)
+      Truncate(text, line);
+  }
+
+  while (*p == ' ' || *p == '\n')
+    p++;
+  if (*p != 0 && layout.count > 0 && !layout.line[layout.count - 1].ellipsis)
+    Truncate(text, layout.line[layout.count - 1]);
+}
+
+/**
+ *  @brief: shortens a line to what fits the box together with the
+ *          ellipsis, which is added to its width
+ */
+void TextBox::Truncate(const char* text, TextLine& line)
+{
+  const char* start = text + line.start;
+  const char* end = start + line.length;
+  const char* q = start;
+  int16_t line_width = 0;
+
+  while (q < end) {
+    const char* after = q;
+    int16_t advance = GetAdvance(Paint::NextCodePoint(&after));
+    if (line_width + advance + ellipsisWidth > width)
+      break;
+    line_width += advance;
+    q = after;
+  }
+  while (q > start && q[-1] == ' ') {
+    q--;
+    line_width -= GetAdvance(' ');
+  }
+  line.length = q - start;
+  line.width = line_width + ellipsisWidth;
+  line.ellipsis = true;
+}
+
+/**
+ *  @brief: widens box to the glyph boxes of length bytes of text drawn at
+ *          (x, y), which can reach left of the pen or past the advance
+ */
+void TextBox::AddInk(PaintRect& box, int16_t x, int16_t y, const char* text, uint16_t length)
+{
+  const char* start = text;
+
+  while (text - start < length && *text != 0) {
+    const pGLYPH* glyph = Paint::FindGlyph(font, Paint::NextCodePoint(&text));
+    if (glyph == NULL)
+      continue;
+
+    int16_t w = pgm_read_byte(&glyph->Width);
+    int16_t h = pgm_read_byte(&glyph->Height);
+    if (w > 0 && h > 0) {
+      int16_t gx = x + (int8_t)pgm_read_byte(&glyph->XOffset);
+      int16_t gy = y + (int8_t)pgm_read_byte(&glyph->YOffset);
+      if (gx < box.x0) box.x0 = gx;
+      if (gy < box.y0) box.y0 = gy;
+      if (gx + w - 1 > box.x1) box.x1 = gx + w - 1;
+      if (gy + h - 1 > box.y1) box.y1 = gy + h - 1;
+    }
+    x += pgm_read_byte(&glyph->XAdvance);
+  }
+}
+
+/**
+ *  @brief: draws the text with its first line top at (x, y) of paint,
+ *          each line aligned within the box width. bounds gets the
+ *          absolute rectangle of the lines drawn, false if there are none.
+ */
+bool TextBox::Draw(Paint& paint, int16_t x, int16_t y, const char* text, int16_t colored, PaintRect* bounds)
+{
+  uint8_t count = Layout(text);
+  const CachedLayout& layout = cache[current];
+  PaintRect box = { INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN };
+
+  for (uint8_t i = 0; i < count; i++) {
+    const TextLine& line = layout.line[i];
+    int16_t lx = x;
+    int16_t ly = y + i * font->Height;
+
+    if (align == ALIGN_CENTER)
+      lx += (width - line.width) / 2;
+    else if (align == ALIGN_RIGHT)
+      lx += width - line.width;
+
+    paint.DrawStringAt(lx, ly, text + line.start, line.length, font, colored);
+    AddInk(box, lx, ly, text + line.start, line.length);
+    if (line.ellipsis) {
+      paint.DrawStringAt(lx + line.width - ellipsisWidth, ly, ellipsis, font, colored);
+      AddInk(box, lx + line.width - ellipsisWidth, ly, ellipsis, strlen(ellipsis));
+    }
+
+    if (line.width <= 0)
+      continue;
+    if (lx < box.x0) box.x0 = lx;
+    if (ly < box.y0) box.y0 = ly;
+    if (lx + line.width - 1 > box.x1) box.x1 = lx + line.width - 1;
+    if (ly + font->Height - 1 > box.y1) box.y1 = ly + font->Height - 1;
+  }
+  if (box.x0 > box.x1)
+    return false;
+
+  if (bounds != NULL) {
+    paint.TransformXY(&box.x0, &box.y0);
+    paint.TransformXY(&box.x1, &box.y1);
+    bounds->x0 = (box.x0 < box.x1 ? box.x0 : box.x1) & ~7;
+    bounds->y0 = box.y0 < box.y1 ? box.y0 : box.y1;
+    bounds->x1 = (box.x0 < box.x1 ? box.x1 : box.x0) | 7;
+    bounds->y1 = box.y0 < box.y1 ? box.y1 : box.y0;
+  }
+  return true;
+}
+
+/* END OF FILE */
@@ -0,0 +1,95 @@
+/**
+ *  @filename   :   epdtextbox.h
+ *  @brief      :   Lays UTF-8 text of a proportional font out in a box,
+ *                  with word wrap, alignment and ellipsis truncation, and
+ *                  keeps the line breaks of the last few texts
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDTEXTBOX_H
+#define EPDTEXTBOX_H
+
+#include "epdpaint.h"
+
+// Lines a TextBox lays out, text beyond them is cut with an ellipsis
+#define TEXTBOX_LINES 8
+
+// Layouts a TextBox keeps, by text hash, font and box size
+#define TEXTBOX_CACHE 4
+
+enum TEXT_ALIGN {
+  ALIGN_LEFT,
+  ALIGN_CENTER,
+  ALIGN_RIGHT,
+};
+
+// Line of a layout, bytes start..start + length - 1 of the text
+struct TextLine {
+  uint16_t start;
+  uint16_t length;
+  int16_t  width;               // advances, the ellipsis included
+  bool     ellipsis;
+};
+
+/**
+ *  Box of width x height pixels in Paint coordinates. Text is split at
+ *  spaces (words wider than the box at a character) and at '\n', the
+ *  last line that fits ends in an ellipsis when text is left over.
+ *  Without wrapping every '\n' separated line is cut instead.
+ *
+ *  Draw() only sets the glyph pixels. The rectangle it returns covers
+ *  the advances of the lines drawn and the glyph boxes reaching beyond
+ *  them, absolute and byte aligned like Paint::GetDirtyRect() but not
+ *  clipped, so erasing the text before drawing a new one is
+ *    paint.FillAbsoluteRect(r.x0, r.y0, r.x1, r.y1, !colored);
+ */
+class TextBox {
+public:
+  TextBox(const pFONT* font, int16_t width, int16_t height, TEXT_ALIGN align = ALIGN_LEFT, bool wrap = true);
+
+  void SetFont(const pFONT* font);
+  void SetSize(int16_t width, int16_t height);
+  inline void SetAlign(TEXT_ALIGN align)  { this->align = align; }
+  void SetWrap(bool wrap);
+
+  uint8_t  Layout(const char* text);
+  const TextLine& GetLine(uint8_t index);
+  int16_t  GetTextHeight(const char* text);
+  inline int16_t Measure(const char* text) { return Paint::GetStringWidth(text, font); }
+  bool     Draw(Paint& paint, int16_t x, int16_t y, const char* text, int16_t colored, PaintRect* bounds = NULL);
+  void     ClearCache(void);
+
+  // layouts computed rather than found in the cache, for profiling
+  inline uint32_t GetLayoutCount(void) { return layouts; }
+
+private:
+  struct CachedLayout {
+    uint32_t  hash;             // key, see Hash()
+    uint16_t  bytes;
+    uint8_t   count;            // lines, 0 for an unused entry
+    TextLine  line[TEXTBOX_LINES];
+  };
+
+  static uint32_t Hash(const char* text, uint16_t* bytes);
+  void     Compute(CachedLayout& layout, const char* text);
+  void     Truncate(const char* text, TextLine& line);
+  int16_t  GetAdvance(uint16_t code);
+  void     AddInk(PaintRect& box, int16_t x, int16_t y, const char* text, uint16_t length);
+
+  const pFONT*  font;
+  int16_t       width;
+  int16_t       height;
+  TEXT_ALIGN    align;
+  bool          wrap;
+  const char*   ellipsis;       // U+2026 where the font has it, else "..."
+  int16_t       ellipsisWidth;
+  CachedLayout  cache[TEXTBOX_CACHE];
+  uint8_t       current;        // entry of the last Layout()
+  uint8_t       next;           // entry replaced next
+  uint32_t      layouts;
+};
+
+#endif /* EPDTEXTBOX_H */
+
+/* END OF FILE */
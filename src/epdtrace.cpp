@@ -0,0 +1,61 @@
+/**
+ *  @filename   :   epdtrace.cpp
+ *  @brief      :   SPI trace recorder, see epdtrace.h
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include "epdtrace.h"
+
+/**
+ *  @brief: appends a record, overwriting the oldest once the buffer is full
+ */
+void EpdTrace::Record(uint8_t type, uint8_t value, uint16_t len) {
+  if (_size == 0) return;
+
+  EpdTraceRecord& r = _records[_next];
+  r.time  = micros();
+  r.type  = type;
+  r.value = value;
+  r.len   = len;
+  _next = (_next + 1) % _size;
+  if (_count < _size) _count++;
+}
+
+void EpdTrace::Pin(uint8_t role, uint8_t level) {
+  if (role == EPD_TRACE_PIN_DC) _dc = level;
+  Record(EPD_TRACE_PIN, role, level);
+}
+
+/**
+ *  @brief: bytes sent with DC low are commands, one record each,
+ *          a data run is one record
+ */
+void EpdTrace::Bytes(const unsigned char* data, int16_t len) {
+  if (len <= 0) return;
+  if (_dc) {
+    Record(EPD_TRACE_DATA, pgm_read_byte(data), len);
+    return;
+  }
+  for (int16_t i = 0; i < len; i++) {
+    Record(EPD_TRACE_COMMAND, pgm_read_byte(data + i));
+  }
+}
+
+void EpdTrace::Fill(unsigned char value, int16_t len) {
+  if (len <= 0) return;
+  if (_dc) {
+    Record(len == 1 ? EPD_TRACE_DATA : EPD_TRACE_FILL, value, len);
+    return;
+  }
+  for (int16_t i = 0; i < len; i++) {
+    Record(EPD_TRACE_COMMAND, value);
+  }
+}
+
+void EpdTrace::Clear(void) {
+  _next = 0;
+  _count = 0;
+}
+
+/* END OF FILE */
@@ -0,0 +1,81 @@
+/**
+ *  @filename   :   epdtrace.h
+ *  @brief      :   Ring buffer of what EpdIf does on the wire, built with
+ *                  -DEPD_TRACE and attached with EpdIf::SetTrace(). Dump it
+ *                  with WriteTo() and analyse it with tools/epdtrace.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDTRACE_H
+#define EPDTRACE_H
+
+#include <Arduino.h>
+
+enum EPD_TRACE_TYPE {
+  EPD_TRACE_COMMAND,        // value: command byte
+  EPD_TRACE_DATA,           // value: first byte, len: bytes
+  EPD_TRACE_FILL,           // value: fill byte, len: bytes
+  EPD_TRACE_PIN,            // value: EPD_TRACE_PIN_xx, len: level
+  EPD_TRACE_DELAY,          // len: ms
+  EPD_TRACE_WAIT_BEGIN,     // blocking wait for BUSY
+  EPD_TRACE_WAIT_END,
+};
+
+enum EPD_TRACE_PIN_ROLE {
+  EPD_TRACE_PIN_CS,
+  EPD_TRACE_PIN_DC,
+  EPD_TRACE_PIN_RST,
+};
+
+// 8 bytes, little endian when dumped
+struct EpdTraceRecord {
+  uint32_t time;            // micros()
+  uint8_t  type;
+  uint8_t  value;
+  uint16_t len;
+};
+
+#define EPD_TRACE_MAGIC   0x54445045    // "EPDT"
+
+class EpdTrace {
+public:
+  EpdTrace(EpdTraceRecord* records, uint16_t size)
+    : _records(records), _size(size), _next(0), _count(0), _dc(true)
+  {}
+
+  void Record(uint8_t type, uint8_t value = 0, uint16_t len = 0);
+  void Pin(uint8_t role, uint8_t level);
+  void Bytes(const unsigned char* data, int16_t len);
+  void Fill(unsigned char value, int16_t len);
+  void Clear(void);
+
+  inline uint16_t GetCount(void) { return _count; }
+  // oldest first
+  inline const EpdTraceRecord& Get(uint16_t index) { return _records[(_next + _size - _count + index) % _size]; }
+
+  /**
+   *  @brief: writes the magic, the record count and the records oldest
+   *          first, to anything with write(const uint8_t*, size_t) such
+   *          as Serial or a TCPClient
+   */
+  template <class Stream>
+  void WriteTo(Stream& out) {
+    uint32_t header[2] = { EPD_TRACE_MAGIC, _count };
+    out.write((const uint8_t*)header, sizeof(header));
+    for (uint16_t i = 0; i < _count; i++) {
+      out.write((const uint8_t*)&Get(i), sizeof(EpdTraceRecord));
+    }
+  }
+
+private:
+  EpdTraceRecord* _records;
+  uint16_t        _size;
+  uint16_t        _next;
+  uint16_t        _count;
+  bool            _dc;      // level of DC, tells commands from data
+};
+
+#endif /* EPDTRACE_H */
+
+/* END OF FILE */
@@ -0,0 +1,67 @@
+/**
+ *  @filename   :   epdwaveform.cpp
+ *  @brief      :   Waveforms shared by several panels, see epdpanel.h
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include "epdpanel.h"
+
+// register LUTs of the IL0373 (2.9") and IL0398 (4.2")
+enum {
+  LUT_FOR_VCOM                   = 0x20,
+  LUT_WHITE_TO_WHITE             = 0x21,
+  LUT_BLACK_TO_WHITE             = 0x22,
+  LUT_WHITE_TO_BLACK             = 0x23,
+  LUT_BLACK_TO_BLACK             = 0x24,
+};
+
+// lut_vcom0, lut_ww, lut_wb and lut_bb of Waveshare's black/white 4.2"
+// (epd4in2.cpp), the black to white LUT is empty so red pixels stay
+const unsigned char EpdRegisterLutFastBw::LUT_FAST[] =
+{
+  LUT_FOR_VCOM,                    44,
+  0x00, 0x17, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x17, 0x17, 0x00, 0x00, 0x02,
+  0x00, 0x0A, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x0E, 0x0E, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+  LUT_WHITE_TO_WHITE,              42,
+  0x40, 0x17, 0x00, 0x00, 0x00, 0x02,
+  0x90, 0x17, 0x17, 0x00, 0x00, 0x02,
+  0x40, 0x0A, 0x01, 0x00, 0x00, 0x01,
+  0xA0, 0x0E, 0x0E, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  LUT_BLACK_TO_WHITE,              42,        // red pixels are not driven
+  0x00, 0x17, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x17, 0x17, 0x00, 0x00, 0x02,
+  0x00, 0x0A, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x0E, 0x0E, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  LUT_WHITE_TO_BLACK,              42,        // white
+  0x40, 0x17, 0x00, 0x00, 0x00, 0x02,
+  0x90, 0x17, 0x17, 0x00, 0x00, 0x02,
+  0x40, 0x0A, 0x01, 0x00, 0x00, 0x01,
+  0xA0, 0x0E, 0x0E, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  LUT_BLACK_TO_BLACK,              42,        // black
+  0x80, 0x17, 0x00, 0x00, 0x00, 0x02,
+  0x90, 0x17, 0x17, 0x00, 0x00, 0x02,
+  0x80, 0x0A, 0x01, 0x00, 0x00, 0x01,
+  0x50, 0x0E, 0x0E, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  EPD_SCRIPT_END
+};
+
+/* END OF FILE */
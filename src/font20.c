@@ -2138,6 +2138,7 @@ sFONT Font20 = {
   Font20_Table,
   14, /* Width */
   20, /* Height */
+  NULL, /* Columns, see Paint::RotateFont() */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
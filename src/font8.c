@@ -1000,6 +1000,7 @@ sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
+  NULL, /* Columns, see Paint::RotateFont() */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
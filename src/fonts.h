@@ -44,27 +44,74 @@
 #define MAX_WIDTH_FONT          17
 #define OFFSET_BITMAP           54
 
+/* Glyphs in every table, ' ' to '~' */
+#define FONT_GLYPHS             95
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
+#include <stddef.h>
 
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
-  
+  const uint8_t *Columns;   /* column-major copy for the landscape orientations, see Paint::RotateFont() */
+
 } sFONT;
 
+/* Glyph of a proportional font, cropped to its bounding box */
+typedef struct _tGlyph
+{
+  uint16_t Offset;          /* first byte of the glyph in pFONT.Bitmap */
+  uint8_t  Width;           /* bounding box, 0 for blank glyphs */
+  uint8_t  Height;
+  int8_t   XOffset;         /* box left of the pen position */
+  int8_t   YOffset;         /* box top below the top of the line */
+  uint8_t  XAdvance;        /* pen movement to the next glyph */
+
+} pGLYPH;
+
+/* Run of consecutive code points that have glyphs */
+typedef struct _tRange
+{
+  uint16_t First;           /* code points First..Last */
+  uint16_t Last;
+  uint16_t Glyph;           /* index of the glyph of First in pFONT.Glyphs */
+
+} pRANGE;
+
+/* Proportional font as generated by tools/fontconv, the glyph boxes are
+   bit-packed row after row without padding. Only the code points in
+   Ranges have glyphs, see Paint::FindGlyph() */
+typedef struct _tPFont
+{
+  const uint8_t *Bitmap;
+  const pGLYPH  *Glyphs;
+  const pRANGE  *Ranges;    /* sorted by code point */
+  uint16_t RangeCount;
+  uint16_t Fallback;        /* code point drawn for missing ones, 0 for none */
+  uint8_t Height;           /* line height */
+  uint8_t Ascent;           /* top of the line to the baseline */
+
+} pFONT;
+
 extern sFONT Font24;
 extern sFONT Font20;
 extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern pFONT PFont24;
+extern pFONT PFont20;
+extern pFONT PFont16;
+extern pFONT PFont12;
+extern pFONT PFont8;
+
 #ifdef __cplusplus
 }
 #endif
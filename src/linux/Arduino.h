@@ -0,0 +1,46 @@
+/**
+ *  @filename   :   Arduino.h
+ *  @brief      :   The part of the Arduino API the library needs, for Linux.
+ *                  Build with -DEPDIF_SPIDEV and src/linux ahead of src in
+ *                  the include path, SPI goes through /dev/spidev (SPI.h),
+ *                  the pins through /sys/class/gpio. With -DEPDIF_SIM both
+ *                  drive the simulated panel of epdsim.h instead.
+ *                  Negative pin numbers are ignored and read HIGH, pass -1
+ *                  for CS (spidev drives chip select itself) and for all
+ *                  pins when testing without a panel.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDIF_LINUX_ARDUINO_H
+#define EPDIF_LINUX_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include "avr/pgmspace.h"
+
+#if defined(EPDIF_SPIDEV) || defined(EPDIF_SIM)
+#define EPDIF_LINUX
+#else
+#error "build with -DEPDIF_SPIDEV or -DEPDIF_SIM"
+#endif
+
+#define HIGH      1
+#define LOW       0
+#define INPUT     0
+#define OUTPUT    1
+#define MSBFIRST  1
+
+void     pinMode(int16_t pin, uint8_t mode);
+void     digitalWrite(int16_t pin, uint8_t value);
+int32_t  digitalRead(int16_t pin);
+uint32_t millis(void);
+uint32_t micros(void);
+void     delay(uint32_t ms);
+void     yield(void);
+
+#endif /* EPDIF_LINUX_ARDUINO_H */
+
+/* END OF FILE */
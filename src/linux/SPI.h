@@ -0,0 +1,82 @@
+/**
+ *  @filename   :   SPI.h
+ *  @brief      :   SPIClass on top of Linux /dev/spidev.
+ *                  Buffers are split into chunks of up to chunkSize bytes and
+ *                  up to batch chunks go out with one SPI_IOC_MESSAGE ioctl,
+ *                  so a whole plane takes a handful of syscalls instead of
+ *                  one per byte. chunkSize * batch must not exceed the
+ *                  bufsiz parameter of the spidev module (4096 by default).
+ *                  With -DEPDIF_SIM the same class feeds the simulated
+ *                  panel instead (sim.cpp), device and fd are unused.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDIF_LINUX_SPI_H
+#define EPDIF_LINUX_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0                 0
+
+#define EPDIF_SPIDEV_DEVICE       "/dev/spidev0.0"
+#define EPDIF_SPIDEV_CLOCK        4000000
+#define EPDIF_SPIDEV_CHUNK        4096
+#define EPDIF_SPIDEV_BATCH        1
+#define EPDIF_SPIDEV_MAX_BATCH    16
+
+typedef void (*wiring_spi_dma_transfercomplete_callback_t)(void);
+
+struct SPISettings {
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+    : clock(clock), dataMode(dataMode)
+  {
+    (void)bitOrder;               // spidev is set up MSB first
+  }
+  uint32_t clock;
+  uint8_t  dataMode;
+};
+
+class SPIClass {
+public:
+  SPIClass(const char* device = EPDIF_SPIDEV_DEVICE, uint32_t clock = EPDIF_SPIDEV_CLOCK,
+           uint16_t chunkSize = EPDIF_SPIDEV_CHUNK, uint8_t batch = EPDIF_SPIDEV_BATCH);
+  ~SPIClass();
+
+  void    begin(void);
+  bool    beginFake(int fd);
+  void    end(void);
+  void    beginTransaction(SPISettings settings);
+  void    endTransaction(void) {}
+  void    setClockSpeed(uint32_t clock);
+  void    setChunkSize(uint16_t chunkSize, uint8_t batch = 1);
+
+  uint8_t transfer(uint8_t data);
+  void    transfer(void* tx, void* rx, size_t len, wiring_spi_dma_transfercomplete_callback_t callback);
+  void    transferFill(uint8_t value, size_t len);
+
+  inline bool     isOpen(void)        { return _fd >= 0; }
+  // syscalls and bytes since begin(), to check throughput
+  inline uint32_t GetMessages(void)   { return _messages; }
+  inline uint32_t GetBytes(void)      { return _bytes; }
+
+private:
+  bool    Send(const unsigned char* tx, unsigned char* rx, size_t len, bool fill);
+
+  const char*    _device;
+  int            _fd;
+  bool           _fake;     // _fd is a plain file or pipe, see beginFake()
+  uint32_t       _clock;
+  uint16_t       _chunkSize;
+  uint8_t        _batch;
+  uint32_t       _messages;
+  uint32_t       _bytes;
+  unsigned char* _fill;
+  uint8_t        _fillValue;
+};
+
+extern SPIClass SPI;
+
+#endif /* EPDIF_LINUX_SPI_H */
+
+/* END OF FILE */
@@ -0,0 +1,17 @@
+/**
+ *  @filename   :   pgmspace.h
+ *  @brief      :   Flash access macros for Linux, flash is plain memory there
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDIF_LINUX_PGMSPACE_H
+#define EPDIF_LINUX_PGMSPACE_H
+
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const unsigned char*)(addr))
+#define pgm_read_word(addr)  (*(const unsigned short*)(addr))
+
+#endif /* EPDIF_LINUX_PGMSPACE_H */
+
+/* END OF FILE */
@@ -0,0 +1,159 @@
+/**
+ *  @filename   :   epdsim.h
+ *  @brief      :   Simulated tri-colour panel for host builds. Built with
+ *                  -DEPDIF_SIM (instead of -DEPDIF_SPIDEV) the pins and SPI
+ *                  of Arduino.h/SPI.h drive SimPanel, which decodes the
+ *                  command and data stream of the controllers in
+ *                  epd1in54b.h ... epd7in5b.h into virtual black/red SRAM,
+ *                  holds BUSY low for configurable times and keeps its own
+ *                  clock, so uploads and refreshes can be timed and checked
+ *                  on any machine. Further EpdSim on other CS pins share
+ *                  the bus and the clock of SimPanel, for several panels.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef EPDSIM_H
+#define EPDSIM_H
+
+#include "epdpanel.h"
+
+enum EPDSIM_COLOR {
+  EPDSIM_WHITE,
+  EPDSIM_BLACK,
+  EPDSIM_RED,
+};
+
+// BUSY low times and bus costs, all in microseconds
+struct EpdSimTiming {
+  uint32_t refreshUs;           // DISPLAY_REFRESH
+  uint32_t partialRefreshUs;    // PARTIAL_DISPLAY_REFRESH (2.7")
+  uint32_t powerOnUs;
+  uint32_t powerOffUs;
+  uint32_t pollUs;              // one read of the BUSY pin
+  uint32_t messageUs;           // setup of one SPI message
+};
+
+class EpdSim {
+public:
+  EpdSim();
+  ~EpdSim();
+
+  template <class Traits>
+  bool Configure(void) {
+    return Configure(Traits::WIDTH, Traits::HEIGHT, Traits::PIXEL_FORMAT, Traits::WINDOW_FORMAT, Traits::CLEAR_BLACK, Traits::CLEAR_RED);
+  }
+  bool Configure(uint16_t width, uint16_t height, EPD_PIXEL_FORMAT pixelFormat, EPD_WINDOW_FORMAT windowFormat, unsigned char clearBlack, unsigned char clearRed);
+  void SetPins(int16_t pinDC, int16_t pinReset, int16_t pinBusy, int16_t pinCS = 10);
+  inline EpdSimTiming& Timing(void) { return _timing; }
+  // off: data is only counted and timed, for benchmarking the drivers
+  inline void SetDecoding(bool decoding) { _decoding = decoding; }
+  // what the temperature sensor reads, 20 by default
+  inline void SetTemperature(float celsius) { _temperature = (int16_t)(celsius * 8); }
+  // DIN not wired for reading, MISO then reads pull instead of the sensor
+  inline void SetDinUnwired(bool unwired, unsigned char pull = 0xFF) { _dinUnwired = unwired; _dinPull = pull; }
+  // keeps the first size commands received from now on, see GetLoggedCommands()
+  inline void LogCommands(unsigned char* log, uint32_t size) { _log = log; _logSize = size; _logged = 0; }
+
+  // controller side, driven by the pins and SPI or by a recorded trace
+  void Reset(void);
+  void Command(unsigned char command);
+  void Data(const unsigned char* data, size_t len);
+  void Data(unsigned char value, size_t len);
+  void Transfer(const unsigned char* data, size_t len, uint32_t clock);
+  void TransferFill(unsigned char value, size_t len, uint32_t clock);
+  void Receive(unsigned char* data, size_t len, uint32_t clock);
+  void PinWrite(int16_t pin, uint8_t value);
+  int32_t PinRead(int16_t pin);
+  void Advance(uint32_t us);
+  bool isBusy(void);
+
+  // panels on the bus, the SPI goes to the one with CS low
+  static EpdSim* Selected(void);
+  inline static EpdSim* First(void) { return _first; }
+  inline EpdSim* Next(void)         { return _next; }
+
+  inline uint64_t GetTimeNs(void)      { return _now; }
+  inline bool     isSleeping(void)     { return _sleeping; }
+  inline uint32_t GetRefreshCount(void)        { return _refreshes; }
+  inline uint32_t GetPartialRefreshCount(void) { return _partialRefreshes; }
+  inline uint32_t GetCommandCount(void)        { return _commands; }
+  inline uint32_t GetDataBytes(void)           { return _dataBytes; }
+  inline uint32_t GetLoggedCommands(void)      { return _logged; }
+  // writes of its CS, DC and RST pins and reads of its BUSY pin
+  inline uint32_t GetPinWrites(void)           { return _pinWrites; }
+  inline uint32_t GetBusyReads(void)           { return _busyReads; }
+  // commands or data sent while BUSY was low or the panel was asleep
+  inline uint32_t GetViolations(void)          { return _violations; }
+
+  EPDSIM_COLOR GetPixel(int16_t x, int16_t y);       // what the panel shows
+  EPDSIM_COLOR GetSramPixel(int16_t x, int16_t y);   // what the next refresh shows
+  bool WritePPM(const char* path);
+  bool WritePBM(const char* path, bool red = false);
+
+private:
+  void DataByte(unsigned char data);
+  void StartPlane(bool red);
+  void WritePlane(unsigned char data);
+  void SetWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  void DecodeWindow(void);
+  void Refresh(int16_t x, int16_t y, int16_t w, int16_t h, bool partial);
+  EPDSIM_COLOR Color(const unsigned char* black, const unsigned char* red, int16_t x, int16_t y);
+
+  uint16_t          _width;
+  uint16_t          _height;
+  EPD_PIXEL_FORMAT  _pixelFormat;
+  EPD_WINDOW_FORMAT _windowFormat;
+  unsigned char     _clearBlack;
+  unsigned char     _clearRed;
+  int16_t           _pinDC;
+  int16_t           _pinReset;
+  int16_t           _pinBusy;
+  int16_t           _pinCS;
+  bool              _selected;
+  EpdSimTiming      _timing;
+
+  // planes hold one bit per pixel, set means ink
+  unsigned char*    _sramBlack;
+  unsigned char*    _sramRed;
+  unsigned char*    _shownBlack;
+  unsigned char*    _shownRed;
+
+  bool              _decoding;
+  bool              _dc;
+  bool              _sleeping;
+  bool              _partial;        // between PARTIAL_IN and PARTIAL_OUT
+  unsigned char     _command;
+  unsigned char     _args[9];
+  uint8_t           _argc;
+  int16_t           _winX, _winY, _winW, _winH;
+  int16_t           _cmdX, _cmdY, _cmdW, _cmdH;  // window of the current data command
+  bool              _planeRed;
+  int32_t           _cursor;
+  unsigned char     _pending;        // first half of a 2bpp pixel byte pair
+  static uint64_t   _now;            // nanoseconds, one clock for all panels
+  uint64_t          _busyUntil;
+  int16_t           _temperature;    // eighths of a degree
+  bool              _dinUnwired;
+  unsigned char     _dinPull;        // what MISO reads when DIN doesn't drive it
+
+  uint32_t          _refreshes;
+  uint32_t          _partialRefreshes;
+  uint32_t          _commands;
+  uint32_t          _dataBytes;
+  uint32_t          _violations;
+  uint32_t          _pinWrites;
+  uint32_t          _busyReads;
+  unsigned char*    _log;
+  uint32_t          _logSize;
+  uint32_t          _logged;
+
+  static EpdSim*    _first;
+  EpdSim*           _next;
+};
+
+extern EpdSim SimPanel;
+
+#endif /* EPDSIM_H */
+
+/* END OF FILE */
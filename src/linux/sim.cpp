@@ -0,0 +1,620 @@
+/**
+ *  @filename   :   sim.cpp
+ *  @brief      :   Simulated panel behind Arduino.h and SPI.h in this
+ *                  directory, only built with -DEPDIF_SIM, see epdsim.h
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#if defined(EPDIF_SIM)
+
+#include <stdio.h>
+#include "SPI.h"
+#include "epdsim.h"
+
+// Command set shared by all controllers of the library
+enum EPDSIM_COMMANDS {
+  EPDSIM_POWER_OFF                         = 0x02,
+  EPDSIM_POWER_ON                          = 0x04,
+  EPDSIM_DEEP_SLEEP                        = 0x07,
+  EPDSIM_DATA_START_TRANSMISSION_1         = 0x10,
+  EPDSIM_DISPLAY_REFRESH                   = 0x12,
+  EPDSIM_DATA_START_TRANSMISSION_2         = 0x13,
+  EPDSIM_PARTIAL_DATA_START_TRANSMISSION_1 = 0x14,
+  EPDSIM_PARTIAL_DATA_START_TRANSMISSION_2 = 0x15,
+  EPDSIM_PARTIAL_DISPLAY_REFRESH           = 0x16,
+  EPDSIM_TEMPERATURE_SENSOR                = 0x40,
+  EPDSIM_PARTIAL_WINDOW                    = 0x90,
+  EPDSIM_PARTIAL_IN                        = 0x91,
+  EPDSIM_PARTIAL_OUT                       = 0x92,
+};
+
+SPIClass SPI;
+EpdSim   SimPanel;
+
+uint64_t EpdSim::_now = 0;
+EpdSim*  EpdSim::_first = NULL;
+
+// completion of the transfer last started with a callback, see yield()
+static wiring_spi_dma_transfercomplete_callback_t dmaDone = NULL;
+
+/*
+ *  Arduino.h on top of the simulated panel, time only moves when the
+ *  library waits, talks to the panel or reads BUSY
+ */
+void pinMode(int16_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(int16_t pin, uint8_t value) {
+  for (EpdSim* panel = EpdSim::First(); panel != NULL; panel = panel->Next())
+    panel->PinWrite(pin, value);
+}
+
+int32_t digitalRead(int16_t pin) {
+  int32_t value = HIGH;
+
+  for (EpdSim* panel = EpdSim::First(); panel != NULL; panel = panel->Next())
+    value &= panel->PinRead(pin);
+  return value;
+}
+
+uint32_t millis(void) {
+  return SimPanel.GetTimeNs() / 1000000;
+}
+
+uint32_t micros(void) {
+  return SimPanel.GetTimeNs() / 1000;
+}
+
+void delay(uint32_t ms) {
+  SimPanel.Advance(ms * 1000);
+}
+
+/**
+ *  @brief: the DMA of a transfer with a callback completes here rather
+ *          than within transfer(), so it is still busy when another
+ *          panel on the bus is polled in between
+ */
+void yield(void) {
+  wiring_spi_dma_transfercomplete_callback_t callback = dmaDone;
+
+  dmaDone = NULL;
+  if (callback) callback();
+}
+
+/*
+ *  SPI.h on top of the simulated panel, messages are split like on
+ *  spidev so message counts match
+ */
+SPIClass::SPIClass(const char* device, uint32_t clock, uint16_t chunkSize, uint8_t batch)
+  : _device(device), _fd(-1), _fake(true), _clock(clock), _chunkSize(0), _batch(1)
+  , _messages(0), _bytes(0), _fill(NULL), _fillValue(0)
+{
+  setChunkSize(chunkSize, batch);
+}
+
+SPIClass::~SPIClass() {
+  free(_fill);
+}
+
+void SPIClass::begin(void) {
+  _fd = 0;
+  _messages = 0;
+  _bytes = 0;
+}
+
+bool SPIClass::beginFake(int fd) {
+  (void)fd;
+  begin();
+  return true;
+}
+
+void SPIClass::end(void) {
+  _fd = -1;
+}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+  setClockSpeed(settings.clock);
+}
+
+void SPIClass::setClockSpeed(uint32_t clock) {
+  _clock = clock;
+}
+
+void SPIClass::setChunkSize(uint16_t chunkSize, uint8_t batch) {
+  if (chunkSize < 1) chunkSize = 1;
+  if (batch < 1) batch = 1;
+  if (batch > EPDIF_SPIDEV_MAX_BATCH) batch = EPDIF_SPIDEV_MAX_BATCH;
+  _chunkSize = chunkSize;
+  _batch = batch;
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  uint8_t rx = 0;
+  Send(&data, &rx, 1, false);
+  return rx;
+}
+
+void SPIClass::transfer(void* tx, void* rx, size_t len, wiring_spi_dma_transfercomplete_callback_t callback) {
+  (void)rx;                       // the panel sends nothing back
+  Send((const unsigned char*)tx, NULL, len, false);
+  dmaDone = callback;
+}
+
+void SPIClass::transferFill(uint8_t value, size_t len) {
+  _fillValue = value;
+  Send(NULL, NULL, len, true);
+}
+
+bool SPIClass::Send(const unsigned char* tx, unsigned char* rx, size_t len, bool fill) {
+  EpdSim* panel = EpdSim::Selected();
+
+  if (_fd < 0) return false;
+
+  while (len > 0) {
+    size_t message = (size_t)_chunkSize * _batch;
+    size_t n = len > message ? message : len;
+
+    panel->Advance(panel->Timing().messageUs);
+    if (fill) {
+      panel->TransferFill(_fillValue, n, _clock);
+    }
+    else if (rx != NULL) {
+      panel->Receive(rx, n, _clock);
+      rx += n;
+    }
+    else {
+      panel->Transfer(tx, n, _clock);
+      tx += n;
+    }
+    _messages++;
+    _bytes += n;
+    len -= n;
+  }
+  return true;
+}
+
+/*
+ *  The panel
+ */
+EpdSim::EpdSim()
+  : _width(0), _height(0), _pixelFormat(EPD_1BPP), _windowFormat(EPD_WINDOW_NONE)
+  , _clearBlack(0xFF), _clearRed(0xFF), _pinDC(9), _pinReset(8), _pinBusy(7), _pinCS(10), _selected(false)
+  , _sramBlack(NULL), _sramRed(NULL), _shownBlack(NULL), _shownRed(NULL)
+  , _decoding(true), _dc(true), _sleeping(false), _partial(false), _command(0), _argc(0)
+  , _winX(0), _winY(0), _winW(0), _winH(0), _cmdX(0), _cmdY(0), _cmdW(0), _cmdH(0)
+  , _planeRed(false), _cursor(-1), _pending(0), _busyUntil(_now)
+  , _temperature(20 * 8), _dinUnwired(false), _dinPull(0xFF)
+  , _refreshes(0), _partialRefreshes(0), _commands(0), _dataBytes(0), _violations(0)
+  , _pinWrites(0), _busyReads(0)
+  , _log(NULL), _logSize(0), _logged(0), _next(_first)
+{
+  _first = this;
+  // rough figures of the 2.9" panel
+  _timing.refreshUs        = 15000000;
+  _timing.partialRefreshUs = 15000000;
+  _timing.powerOnUs        = 80000;
+  _timing.powerOffUs       = 20000;
+  _timing.pollUs           = 1;
+  _timing.messageUs        = 0;
+}
+
+EpdSim::~EpdSim() {
+  EpdSim** link = &_first;
+
+  while (*link != this) link = &(*link)->_next;
+  *link = _next;
+  free(_sramBlack);
+  free(_sramRed);
+  free(_shownBlack);
+  free(_shownRed);
+}
+
+/**
+ *  @brief: sets up the panel, usually Configure<EpdXXXTraits>()
+ */
+bool EpdSim::Configure(uint16_t width, uint16_t height, EPD_PIXEL_FORMAT pixelFormat, EPD_WINDOW_FORMAT windowFormat, unsigned char clearBlack, unsigned char clearRed) {
+  size_t bytes = (size_t)width * height / 8;
+
+  _width = width;
+  _height = height;
+  _pixelFormat = pixelFormat;
+  _windowFormat = windowFormat;
+  _clearBlack = clearBlack;
+  _clearRed = clearRed;
+
+  _sramBlack = (unsigned char*)realloc(_sramBlack, bytes);
+  _sramRed = (unsigned char*)realloc(_sramRed, bytes);
+  _shownBlack = (unsigned char*)realloc(_shownBlack, bytes);
+  _shownRed = (unsigned char*)realloc(_shownRed, bytes);
+  if (!_sramBlack || !_sramRed || !_shownBlack || !_shownRed) return false;
+
+  memset(_sramBlack, 0, bytes);
+  memset(_sramRed, 0, bytes);
+  memset(_shownBlack, 0, bytes);
+  memset(_shownRed, 0, bytes);
+  Reset();
+  return true;
+}
+
+/**
+ *  @brief: the pins of the Epd constructor, panels sharing the bus need
+ *          their own CS, RST and BUSY
+ */
+void EpdSim::SetPins(int16_t pinDC, int16_t pinReset, int16_t pinBusy, int16_t pinCS) {
+  _pinDC = pinDC;
+  _pinReset = pinReset;
+  _pinBusy = pinBusy;
+  _pinCS = pinCS;
+}
+
+/**
+ *  @brief: panel with CS low, SimPanel when there is none
+ */
+EpdSim* EpdSim::Selected(void) {
+  for (EpdSim* panel = _first; panel != NULL; panel = panel->_next) {
+    if (panel->_selected) return panel;
+  }
+  return &SimPanel;
+}
+
+/**
+ *  @brief: hardware reset, wakes the controller, SRAM is kept
+ */
+void EpdSim::Reset(void) {
+  _sleeping = false;
+  _partial = false;
+  _command = 0;
+  _argc = 0;
+  _cursor = -1;
+  _busyUntil = _now;
+  SetWindow(0, 0, _width, _height);
+}
+
+void EpdSim::Advance(uint32_t us) {
+  _now += (uint64_t)us * 1000;
+}
+
+bool EpdSim::isBusy(void) {
+  return _now < _busyUntil;
+}
+
+void EpdSim::PinWrite(int16_t pin, uint8_t value) {
+  if (pin == _pinCS || pin == _pinDC || pin == _pinReset) _pinWrites++;
+  if (pin == _pinCS) {
+    _selected = !value;
+  }
+  else if (pin == _pinDC) {
+    _dc = value;
+  }
+  else if (pin == _pinReset && !value) {
+    Reset();
+  }
+}
+
+/**
+ *  @brief: BUSY is LOW while busy, every read costs Timing().pollUs so
+ *          waiting loops move the clock on
+ */
+int32_t EpdSim::PinRead(int16_t pin) {
+  if (pin != _pinBusy) return HIGH;
+  _busyReads++;
+  Advance(_timing.pollUs);
+  return isBusy() ? LOW : HIGH;
+}
+
+/**
+ *  @brief: bytes clocked out at clock Hz, DC decides whether they are
+ *          commands or data
+ */
+void EpdSim::Transfer(const unsigned char* data, size_t len, uint32_t clock) {
+  if (_dc) {
+    Data(data, len);
+  }
+  else {
+    for (size_t i = 0; i < len; i++) Command(data[i]);
+  }
+  _now += (uint64_t)len * 8 * 1000000000 / clock;
+}
+
+/**
+ *  @brief: bytes clocked in, only the temperature sensor answers: whole
+ *          degrees, then eighths in the top 3 bits. Anything else reads
+ *          as an undriven DIN, see SetDinUnwired().
+ */
+void EpdSim::Receive(unsigned char* data, size_t len, uint32_t clock) {
+  for (size_t i = 0; i < len; i++) {
+    unsigned char value = _dinPull;
+    if (!_dinUnwired && _dc && !_sleeping && _command == EPDSIM_TEMPERATURE_SENSOR && _argc < 2) {
+      value = _argc == 0 ? (unsigned char)(_temperature >> 3) : (unsigned char)((_temperature & 7) << 5);
+      _argc++;
+    }
+    data[i] = value;
+  }
+  _now += (uint64_t)len * 8 * 1000000000 / clock;
+}
+
+void EpdSim::TransferFill(unsigned char value, size_t len, uint32_t clock) {
+  if (_dc) {
+    Data(value, len);
+  }
+  else {
+    for (size_t i = 0; i < len; i++) Command(value);
+  }
+  _now += (uint64_t)len * 8 * 1000000000 / clock;
+}
+
+void EpdSim::Command(unsigned char command) {
+  _commands++;
+  if (_logged < _logSize) _log[_logged++] = command;
+  if (_sleeping || isBusy()) {
+    _violations++;
+    return;
+  }
+  _command = command;
+  _argc = 0;
+  _cursor = -1;
+
+  switch (command) {
+    case EPDSIM_POWER_ON:
+      _busyUntil = _now + (uint64_t)_timing.powerOnUs * 1000;
+      break;
+    case EPDSIM_POWER_OFF:
+      _busyUntil = _now + (uint64_t)_timing.powerOffUs * 1000;
+      break;
+    case EPDSIM_DISPLAY_REFRESH:
+      Refresh(0, 0, _width, _height, false);
+      break;
+    case EPDSIM_PARTIAL_IN:
+      _partial = true;
+      break;
+    case EPDSIM_PARTIAL_OUT:
+      _partial = false;
+      break;
+    case EPDSIM_DATA_START_TRANSMISSION_1:
+      StartPlane(false);
+      break;
+    case EPDSIM_DATA_START_TRANSMISSION_2:
+      // IMAGE_PROCESS on the 7.5", which has a single plane
+      if (_pixelFormat != EPD_4BPP) StartPlane(true);
+      break;
+  }
+}
+
+void EpdSim::Data(const unsigned char* data, size_t len) {
+  _dataBytes += len;
+  if (_sleeping || isBusy()) {
+    _violations++;
+    return;
+  }
+  if (!_decoding) return;
+  for (size_t i = 0; i < len; i++) DataByte(pgm_read_byte(data + i));
+}
+
+void EpdSim::Data(unsigned char value, size_t len) {
+  _dataBytes += len;
+  if (_sleeping || isBusy()) {
+    _violations++;
+    return;
+  }
+  if (!_decoding) return;
+  for (size_t i = 0; i < len; i++) DataByte(value);
+}
+
+void EpdSim::DataByte(unsigned char data) {
+  switch (_command) {
+    case EPDSIM_DEEP_SLEEP:
+      if (data == 0xA5) _sleeping = true;
+      break;
+    case EPDSIM_PARTIAL_WINDOW:
+      if (_argc < sizeof(_args)) _args[_argc++] = data;
+      DecodeWindow();
+      break;
+    case EPDSIM_DATA_START_TRANSMISSION_1:
+    case EPDSIM_DATA_START_TRANSMISSION_2:
+      if (_cursor >= 0) WritePlane(data);
+      break;
+    case EPDSIM_PARTIAL_DATA_START_TRANSMISSION_1:
+    case EPDSIM_PARTIAL_DATA_START_TRANSMISSION_2:
+    case EPDSIM_PARTIAL_DISPLAY_REFRESH:
+      if (_windowFormat != EPD_WINDOW_PARTIAL_DTM) break;
+      if (_argc < 8) {
+        _args[_argc++] = data;
+        if (_argc < 8) break;
+        _cmdX = (_args[0] << 8 | _args[1]) & ~7;
+        _cmdY = _args[2] << 8 | _args[3];
+        _cmdW = (_args[4] << 8 | _args[5]) & ~7;
+        _cmdH = _args[6] << 8 | _args[7];
+        if (_command == EPDSIM_PARTIAL_DISPLAY_REFRESH) {
+          Refresh(_cmdX, _cmdY, _cmdW, _cmdH, true);
+        }
+        else {
+          _planeRed = _command == EPDSIM_PARTIAL_DATA_START_TRANSMISSION_2;
+          _cursor = 0;
+        }
+      }
+      else if (_cursor >= 0) {
+        WritePlane(data);
+      }
+      break;
+  }
+}
+
+/**
+ *  @brief: PARTIAL_WINDOW data, 8 bit x (EPD_WINDOW_X8) or 16 bit x
+ *          (EPD_WINDOW_X16), then 16 bit y, x and y ends are inclusive
+ */
+void EpdSim::DecodeWindow(void) {
+  int16_t x0, x1;
+  const unsigned char* y;
+
+  if (_windowFormat == EPD_WINDOW_X8 && _argc == 7) {
+    x0 = _args[0];
+    x1 = _args[1];
+    y = _args + 2;
+  }
+  else if (_windowFormat == EPD_WINDOW_X16 && _argc == 9) {
+    x0 = _args[0] << 8 | _args[1];
+    x1 = _args[2] << 8 | _args[3];
+    y = _args + 4;
+  }
+  else {
+    return;
+  }
+  int16_t y0 = y[0] << 8 | y[1];
+  int16_t y1 = y[2] << 8 | y[3];
+  _winX = x0 & ~7;
+  _winY = y0;
+  _winW = (x1 | 7) - _winX + 1;
+  _winH = y1 - y0 + 1;
+}
+
+void EpdSim::SetWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  _winX = x;
+  _winY = y;
+  _winW = w;
+  _winH = h;
+}
+
+void EpdSim::StartPlane(bool red) {
+  if (_partial) {
+    _cmdX = _winX; _cmdY = _winY; _cmdW = _winW; _cmdH = _winH;
+  }
+  else {
+    _cmdX = 0; _cmdY = 0; _cmdW = _width; _cmdH = _height;
+  }
+  _planeRed = red;
+  _cursor = 0;
+}
+
+/**
+ *  @brief: stores one data byte at the cursor of the current window,
+ *          converting the pixel format and polarity to ink bits
+ */
+void EpdSim::WritePlane(unsigned char data) {
+  int32_t pixel;
+
+  switch (_pixelFormat) {
+    case EPD_4BPP:
+      pixel = _cursor * 2;
+      for (int i = 0; i < 2; i++, pixel++, data <<= 4) {
+        int16_t x = pixel % _width;
+        int16_t y = pixel / _width;
+        if (y >= _height) return;
+        size_t at = (size_t)y * (_width / 8) + x / 8;
+        unsigned char bit = 0x80 >> (x % 8);
+        unsigned char nibble = data >> 4;
+        _sramBlack[at] = nibble == 0x00 ? (_sramBlack[at] | bit) : (_sramBlack[at] & ~bit);
+        _sramRed[at]   = nibble == 0x04 ? (_sramRed[at] | bit) : (_sramRed[at] & ~bit);
+      }
+      _cursor++;
+      return;
+    case EPD_2BPP_BLACK:
+      if (!_planeRed) {
+        // two bits per pixel, the pair of a set source bit is 11
+        if (!(_cursor & 1)) {
+          _pending = data;
+          _cursor++;
+          return;
+        }
+        unsigned char packed = 0;
+        for (int i = 0; i < 4; i++) {
+          packed |= ((_pending >> (7 - 2 * i)) & 1) << (7 - i);
+          packed |= ((data >> (7 - 2 * i)) & 1) << (3 - i);
+        }
+        data = packed;
+        pixel = _cursor / 2;
+        _cursor++;
+        break;
+      }
+      // the red plane is plain 1bpp
+      // fall through
+    default:
+      pixel = _cursor++;
+      break;
+  }
+
+  int16_t rowBytes = _cmdW / 8;
+  if (rowBytes <= 0 || pixel >= (int32_t)rowBytes * _cmdH) return;
+  int16_t x = _cmdX + (pixel % rowBytes) * 8;
+  int16_t y = _cmdY + pixel / rowBytes;
+  if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+
+  size_t at = (size_t)y * (_width / 8) + x / 8;
+  if (_planeRed) _sramRed[at] = data ^ _clearRed;
+  else _sramBlack[at] = data ^ _clearBlack;
+}
+
+void EpdSim::Refresh(int16_t x, int16_t y, int16_t w, int16_t h, bool partial) {
+  int16_t stride = _width / 8;
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  for (int16_t row = y; row < y + h; row++) {
+    memcpy(_shownBlack + row * stride + x / 8, _sramBlack + row * stride + x / 8, w / 8);
+    memcpy(_shownRed + row * stride + x / 8, _sramRed + row * stride + x / 8, w / 8);
+  }
+  if (partial) {
+    _partialRefreshes++;
+    _busyUntil = _now + (uint64_t)_timing.partialRefreshUs * 1000;
+  }
+  else {
+    _refreshes++;
+    _busyUntil = _now + (uint64_t)_timing.refreshUs * 1000;
+  }
+}
+
+EPDSIM_COLOR EpdSim::Color(const unsigned char* black, const unsigned char* red, int16_t x, int16_t y) {
+  if (x < 0 || x >= _width || y < 0 || y >= _height) return EPDSIM_WHITE;
+
+  size_t at = (size_t)y * (_width / 8) + x / 8;
+  unsigned char bit = 0x80 >> (x % 8);
+  if (red[at] & bit) return EPDSIM_RED;
+  if (black[at] & bit) return EPDSIM_BLACK;
+  return EPDSIM_WHITE;
+}
+
+EPDSIM_COLOR EpdSim::GetPixel(int16_t x, int16_t y) {
+  return Color(_shownBlack, _shownRed, x, y);
+}
+
+EPDSIM_COLOR EpdSim::GetSramPixel(int16_t x, int16_t y) {
+  return Color(_sramBlack, _sramRed, x, y);
+}
+
+/**
+ *  @brief: writes what the panel shows as a colour netpbm image
+ */
+bool EpdSim::WritePPM(const char* path) {
+  static const unsigned char rgb[3][3] = { {255, 255, 255}, {0, 0, 0}, {255, 0, 0} };
+  FILE* f = fopen(path, "wb");
+
+  if (f == NULL) return false;
+  fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+  for (int16_t y = 0; y < _height; y++) {
+    for (int16_t x = 0; x < _width; x++) {
+      fwrite(rgb[GetPixel(x, y)], 1, 3, f);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+/**
+ *  @brief: writes the shown black (or red) plane as a bitmap, 1 is ink
+ */
+bool EpdSim::WritePBM(const char* path, bool red) {
+  FILE* f = fopen(path, "wb");
+
+  if (f == NULL) return false;
+  fprintf(f, "P4\n%d %d\n", _width, _height);
+  fwrite(red ? _shownRed : _shownBlack, 1, (size_t)_width * _height / 8, f);
+  return fclose(f) == 0;
+}
+
+#endif /* EPDIF_SIM */
+
+/* END OF FILE */
@@ -0,0 +1,228 @@
+/**
+ *  @filename   :   spidev.cpp
+ *  @brief      :   Linux implementation of Arduino.h and SPI.h in this
+ *                  directory, only built with -DEPDIF_SPIDEV
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#if defined(EPDIF_SPIDEV)
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <linux/spi/spidev.h>
+#include "SPI.h"
+
+#define EPDIF_GPIO_MAX  64
+
+SPIClass SPI;
+
+// value file of each exported pin, + 1 so 0 means not set up
+static int gpioFd[EPDIF_GPIO_MAX];
+
+static void gpioWrite(const char* path, const char* value) {
+  int fd = open(path, O_WRONLY);
+  if (fd < 0) return;
+  if (write(fd, value, strlen(value)) < 0) {
+    // already exported or no permission, opening the value file tells
+  }
+  close(fd);
+}
+
+void pinMode(int16_t pin, uint8_t mode) {
+  char path[48];
+
+  if (pin < 0 || pin >= EPDIF_GPIO_MAX) return;
+
+  snprintf(path, sizeof(path), "%d", pin);
+  gpioWrite("/sys/class/gpio/export", path);
+  snprintf(path, sizeof(path), "/sys/class/gpio/gpio%d/direction", pin);
+  gpioWrite(path, mode == OUTPUT ? "out" : "in");
+
+  if (gpioFd[pin]) close(gpioFd[pin] - 1);
+  snprintf(path, sizeof(path), "/sys/class/gpio/gpio%d/value", pin);
+  gpioFd[pin] = open(path, mode == OUTPUT ? O_RDWR : O_RDONLY) + 1;
+}
+
+void digitalWrite(int16_t pin, uint8_t value) {
+  if (pin < 0 || pin >= EPDIF_GPIO_MAX || !gpioFd[pin]) return;
+  if (pwrite(gpioFd[pin] - 1, value ? "1" : "0", 1, 0) < 0) return;
+}
+
+int32_t digitalRead(int16_t pin) {
+  char c;
+
+  if (pin < 0 || pin >= EPDIF_GPIO_MAX || !gpioFd[pin]) return HIGH;
+  if (pread(gpioFd[pin] - 1, &c, 1, 0) != 1) return HIGH;
+  return c == '1' ? HIGH : LOW;
+}
+
+static uint64_t monotonicUs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint32_t millis(void) {
+  return monotonicUs() / 1000;
+}
+
+uint32_t micros(void) {
+  return monotonicUs();
+}
+
+void delay(uint32_t ms) {
+  struct timespec ts;
+  ts.tv_sec = ms / 1000;
+  ts.tv_nsec = (long)(ms % 1000) * 1000000;
+  while (nanosleep(&ts, &ts) < 0);
+}
+
+void yield(void) {
+}
+
+SPIClass::SPIClass(const char* device, uint32_t clock, uint16_t chunkSize, uint8_t batch)
+  : _device(device), _fd(-1), _fake(false), _clock(clock), _chunkSize(0), _batch(1)
+  , _messages(0), _bytes(0), _fill(NULL), _fillValue(0)
+{
+  setChunkSize(chunkSize, batch);
+}
+
+SPIClass::~SPIClass() {
+  end();
+  free(_fill);
+}
+
+/**
+ *  @brief: opens the spidev device in mode 0, 8 bit words
+ */
+void SPIClass::begin(void) {
+  uint8_t mode = SPI_MODE_0;
+  uint8_t bits = 8;
+
+  if (_fd >= 0) return;
+
+  _fd = open(_device, O_RDWR);
+  if (_fd < 0) return;
+  if (ioctl(_fd, SPI_IOC_WR_MODE, &mode) < 0
+   || ioctl(_fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0
+   || ioctl(_fd, SPI_IOC_WR_MAX_SPEED_HZ, &_clock) < 0) {
+    close(_fd);
+    _fd = -1;
+    return;
+  }
+  _messages = 0;
+  _bytes = 0;
+}
+
+/**
+ *  @brief: test mode, each SPI_IOC_MESSAGE batch becomes one writev() of
+ *          the same chunks to fd (a file, pipe or /dev/null), so uploads
+ *          and syscall counts can be checked without a panel.
+ *          fd stays owned by the caller.
+ */
+bool SPIClass::beginFake(int fd) {
+  end();
+  _fd = fd;
+  _fake = true;
+  _messages = 0;
+  _bytes = 0;
+  return _fd >= 0;
+}
+
+void SPIClass::end(void) {
+  if (_fd >= 0 && !_fake) close(_fd);
+  _fd = -1;
+  _fake = false;
+}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+  setClockSpeed(settings.clock);
+}
+
+void SPIClass::setClockSpeed(uint32_t clock) {
+  _clock = clock;
+  if (_fd >= 0 && !_fake) ioctl(_fd, SPI_IOC_WR_MAX_SPEED_HZ, &_clock);
+}
+
+/**
+ *  @brief: bytes per spi_ioc_transfer and transfers per ioctl
+ */
+void SPIClass::setChunkSize(uint16_t chunkSize, uint8_t batch) {
+  if (chunkSize < 1) chunkSize = 1;
+  if (batch < 1) batch = 1;
+  if (batch > EPDIF_SPIDEV_MAX_BATCH) batch = EPDIF_SPIDEV_MAX_BATCH;
+
+  unsigned char* fill = (unsigned char*)realloc(_fill, chunkSize);
+  if (fill == NULL) return;
+  _fill = fill;
+  memset(_fill, _fillValue, chunkSize);
+  _chunkSize = chunkSize;
+  _batch = batch;
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  uint8_t rx = 0;
+  Send(&data, &rx, 1, false);
+  return rx;
+}
+
+/**
+ *  @brief: same signature as the Particle DMA transfer, but it returns
+ *          once the data is out and then calls callback. rx can be NULL.
+ */
+void SPIClass::transfer(void* tx, void* rx, size_t len, wiring_spi_dma_transfercomplete_callback_t callback) {
+  Send((const unsigned char*)tx, (unsigned char*)rx, len, false);
+  if (callback) callback();
+}
+
+/**
+ *  @brief: sends len copies of value
+ */
+void SPIClass::transferFill(uint8_t value, size_t len) {
+  if (value != _fillValue) {
+    _fillValue = value;
+    memset(_fill, value, _chunkSize);
+  }
+  Send(_fill, NULL, len, true);
+}
+
+bool SPIClass::Send(const unsigned char* tx, unsigned char* rx, size_t len, bool fill) {
+  struct spi_ioc_transfer xfer[EPDIF_SPIDEV_MAX_BATCH];
+  struct iovec iov[EPDIF_SPIDEV_MAX_BATCH];
+
+  if (_fd < 0) return false;
+
+  while (len > 0) {
+    int n = 0;
+    size_t sent = 0;
+
+    memset(xfer, 0, sizeof(xfer));
+    for (; n < _batch && len > 0; n++) {
+      size_t chunk = len > _chunkSize ? _chunkSize : len;
+      xfer[n].tx_buf = (unsigned long)tx;
+      xfer[n].rx_buf = (unsigned long)rx;
+      xfer[n].len = chunk;
+      xfer[n].speed_hz = _clock;
+      xfer[n].bits_per_word = 8;
+      iov[n].iov_base = (void*)tx;
+      iov[n].iov_len = chunk;
+      if (!fill) tx += chunk;
+      if (rx != NULL) rx += chunk;
+      sent += chunk;
+      len -= chunk;
+    }
+    if ((_fake ? writev(_fd, iov, n) : ioctl(_fd, SPI_IOC_MESSAGE(n), xfer)) < 0) return false;
+    _messages++;
+    _bytes += sent;
+  }
+  return true;
+}
+
+#endif /* EPDIF_SPIDEV */
+
+/* END OF FILE */
@@ -0,0 +1,220 @@
+/**
+ *  @brief      :   PFont12, proportional, generated by tools/fontconv from Font12
+ */
+
+#include "fonts.h"
+#include <avr/pgmspace.h>
+
+const uint8_t PFont12_Bitmap[] PROGMEM =
+{
+  0xF9,   // '!'
+  0xDC, 0xA4,   // '"'
+  0x29, 0x55, 0xF5, 0x7D, 0x54, 0xA0,   // '#'
+  0x27, 0x88, 0x79, 0xE2, 0x20,   // '$'
+  0x45, 0x10, 0x3E, 0x08, 0xA2,   // '%'
+  0x32, 0x11, 0x59, 0x34,   // '&'
+  0xF0,   // U+0027
+  0x5A, 0xAA, 0x50,   // '('
+  0xA5, 0x55, 0xA0,   // ')'
+  0x27, 0xC8, 0xA5, 0x00,   // '*'
+  0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,   // '+'
+  0x6B, 0x40,   // ','
+  0xF8,   // '-'
+  0xF0,   // '.'
+  0x08, 0x44, 0x22, 0x11, 0x08, 0x80,   // '/'
+  0x74, 0x63, 0x18, 0xC6, 0x2E,   // '0'
+  0x61, 0x08, 0x42, 0x10, 0x9F,   // '1'
+  0x74, 0x42, 0x22, 0x22, 0x3F,   // '2'
+  0x74, 0x42, 0x60, 0x86, 0x2E,   // '3'
+  0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87,   // '4'
+  0x7A, 0x10, 0xE0, 0x86, 0x2E,   // '5'
+  0x3A, 0x21, 0xE8, 0xC6, 0x2E,   // '6'
+  0xFC, 0x42, 0x21, 0x08, 0x84,   // '7'
+  0x74, 0x62, 0xE8, 0xC6, 0x2E,   // '8'
+  0x74, 0x63, 0x17, 0x84, 0x5C,   // '9'
+  0xF0, 0xF0,   // ':'
+  0x6C, 0x07, 0xA0,   // ';'
+  0x0C, 0x46, 0x20, 0x60, 0x40, 0xC0,   // '<'
+  0xF8, 0x3E,   // '='
+  0xC0, 0x81, 0x81, 0x18, 0x8C, 0x00,   // '>'
+  0x69, 0x12, 0x40, 0xC0,   // '?'
+  0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80,   // '@'
+  0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77,   // 'A'
+  0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E,   // 'B'
+  0x7C, 0x61, 0x08, 0x42, 0x2E,   // 'C'
+  0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC,   // 'D'
+  0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F,   // 'E'
+  0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38,   // 'F'
+  0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C,   // 'G'
+  0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77,   // 'H'
+  0xF9, 0x08, 0x42, 0x10, 0x9F,   // 'I'
+  0x78, 0x84, 0x29, 0x4A, 0x4C,   // 'J'
+  0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73,   // 'K'
+  0xE2, 0x10, 0x84, 0x25, 0x3F,   // 'L'
+  0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77,   // 'M'
+  0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76,   // 'N'
+  0x74, 0x63, 0x18, 0xC6, 0x2E,   // 'O'
+  0xF2, 0x52, 0x97, 0x21, 0x1C,   // 'P'
+  0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38,   // 'Q'
+  0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71,   // 'R'
+  0x6C, 0xE0, 0xE0, 0x87, 0x36,   // 'S'
+  0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C,   // 'T'
+  0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C,   // 'U'
+  0xEE, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08,   // 'V'
+  0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14,   // 'W'
+  0xC6, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x63,   // 'X'
+  0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C,   // 'Y'
+  0xFC, 0x44, 0x42, 0x22, 0x3F,   // 'Z'
+  0xF2, 0x49, 0x24, 0x9C,   // '['
+  0x84, 0x44, 0x22, 0x11, 0x10,   // U+005C
+  0xE4, 0x92, 0x49, 0x3C,   // ']'
+  0x21, 0x15, 0x10,   // '^'
+  0xFE,   // '_'
+  0x90,   // '`'
+  0x72, 0x27, 0xA2, 0x89, 0xF0,   // 'a'
+  0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E,   // 'b'
+  0x7C, 0x61, 0x08, 0xB8,   // 'c'
+  0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F,   // 'd'
+  0x74, 0x7F, 0x08, 0x3C,   // 'e'
+  0x3A, 0x3E, 0x84, 0x21, 0x1F,   // 'f'
+  0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C,   // 'g'
+  0xC0, 0x81, 0x63, 0x24, 0x48, 0x91, 0x77,   // 'h'
+  0x20, 0x38, 0x42, 0x10, 0x9F,   // 'i'
+  0x20, 0xF1, 0x11, 0x11, 0x1E,   // 'j'
+  0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7,   // 'k'
+  0x61, 0x08, 0x42, 0x10, 0x9F,   // 'l'
+  0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0,   // 'm'
+  0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0,   // 'n'
+  0x74, 0x63, 0x18, 0xB8,   // 'o'
+  0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38,   // 'p'
+  0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87,   // 'q'
+  0xDB, 0x10, 0x84, 0x7C,   // 'r'
+  0x7C, 0x5C, 0x18, 0xF8,   // 's'
+  0x43, 0xE4, 0x10, 0x41, 0x13, 0x80,   // 't'
+  0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0,   // 'u'
+  0xEE, 0x89, 0x11, 0x42, 0x82, 0x00,   // 'v'
+  0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00,   // 'w'
+  0xCD, 0x23, 0x0C, 0x4B, 0x30,   // 'x'
+  0xEE, 0x88, 0x91, 0x41, 0x82, 0x04, 0x3C,   // 'y'
+  0xFC, 0x88, 0x88, 0xFC,   // 'z'
+  0x29, 0x25, 0x12, 0x44,   // '{'
+  0xFF, 0x80,   // '|'
+  0x89, 0x24, 0x52, 0x50,   // '}'
+  0x4D, 0x80,   // '~'
+};
+
+const pGLYPH PFont12_Glyphs[] PROGMEM =
+{
+  // offset, width, height, xOffset, yOffset, xAdvance
+  {     0,   0,   0,   0,   0,   4 },   // U+0020
+  {     0,   1,   8,   0,   1,   2 },   // '!'
+  {     1,   5,   3,   0,   1,   6 },   // '"'
+  {     3,   5,   9,   0,   1,   6 },   // '#'
+  {     9,   4,   9,   0,   1,   5 },   // '$'
+  {    14,   5,   8,   0,   1,   6 },   // '%'
+  {    19,   5,   6,   0,   3,   6 },   // '&'
+  {    23,   1,   4,   0,   1,   2 },   // U+0027
+  {    24,   2,  10,   0,   1,   3 },   // '('
+  {    27,   2,  10,   0,   1,   3 },   // ')'
+  {    30,   5,   5,   0,   1,   6 },   // '*'
+  {    34,   7,   7,   0,   2,   8 },   // '+'
+  {    41,   3,   4,   0,   7,   4 },   // ','
+  {    43,   5,   1,   0,   5,   6 },   // '-'
+  {    44,   2,   2,   0,   7,   3 },   // '.'
+  {    45,   5,   9,   0,   1,   6 },   // '/'
+  {    51,   5,   8,   0,   1,   6 },   // '0'
+  {    56,   5,   8,   0,   1,   6 },   // '1'
+  {    61,   5,   8,   0,   1,   6 },   // '2'
+  {    66,   5,   8,   0,   1,   6 },   // '3'
+  {    71,   6,   8,   0,   1,   7 },   // '4'
+  {    77,   5,   8,   0,   1,   6 },   // '5'
+  {    82,   5,   8,   0,   1,   6 },   // '6'
+  {    87,   5,   8,   0,   1,   6 },   // '7'
+  {    92,   5,   8,   0,   1,   6 },   // '8'
+  {    97,   5,   8,   0,   1,   6 },   // '9'
+  {   102,   2,   6,   0,   3,   3 },   // ':'
+  {   104,   3,   7,   0,   3,   4 },   // ';'
+  {   107,   6,   7,   0,   2,   7 },   // '<'
+  {   113,   5,   3,   0,   4,   6 },   // '='
+  {   115,   6,   7,   0,   2,   7 },   // '>'
+  {   121,   4,   7,   0,   2,   5 },   // '?'
+  {   125,   5,  10,   0,   0,   6 },   // '@'
+  {   132,   7,   8,   0,   1,   8 },   // 'A'
+  {   139,   6,   8,   0,   1,   7 },   // 'B'
+  {   145,   5,   8,   0,   1,   6 },   // 'C'
+  {   150,   6,   8,   0,   1,   7 },   // 'D'
+  {   156,   6,   8,   0,   1,   7 },   // 'E'
+  {   162,   6,   8,   0,   1,   7 },   // 'F'
+  {   168,   6,   8,   0,   1,   7 },   // 'G'
+  {   174,   7,   8,   0,   1,   8 },   // 'H'
+  {   181,   5,   8,   0,   1,   6 },   // 'I'
+  {   186,   5,   8,   0,   1,   6 },   // 'J'
+  {   191,   7,   8,   0,   1,   8 },   // 'K'
+  {   198,   5,   8,   0,   1,   6 },   // 'L'
+  {   203,   7,   8,   0,   1,   8 },   // 'M'
+  {   210,   7,   8,   0,   1,   8 },   // 'N'
+  {   217,   5,   8,   0,   1,   6 },   // 'O'
+  {   222,   5,   8,   0,   1,   6 },   // 'P'
+  {   227,   5,   9,   0,   1,   6 },   // 'Q'
+  {   233,   7,   8,   0,   1,   8 },   // 'R'
+  {   240,   5,   8,   0,   1,   6 },   // 'S'
+  {   245,   7,   8,   0,   1,   8 },   // 'T'
+  {   252,   7,   8,   0,   1,   8 },   // 'U'
+  {   259,   7,   8,   0,   1,   8 },   // 'V'
+  {   266,   7,   8,   0,   1,   8 },   // 'W'
+  {   273,   7,   8,   0,   1,   8 },   // 'X'
+  {   280,   7,   8,   0,   1,   8 },   // 'Y'
+  {   287,   5,   8,   0,   1,   6 },   // 'Z'
+  {   292,   3,  10,   0,   1,   4 },   // '['
+  {   296,   4,   9,   0,   1,   5 },   // U+005C
+  {   301,   3,  10,   0,   1,   4 },   // ']'
+  {   305,   5,   4,   0,   1,   6 },   // '^'
+  {   308,   7,   1,   0,  11,   8 },   // '_'
+  {   309,   2,   2,   0,   1,   3 },   // '`'
+  {   310,   6,   6,   0,   3,   7 },   // 'a'
+  {   315,   6,   8,   0,   1,   7 },   // 'b'
+  {   321,   5,   6,   0,   3,   6 },   // 'c'
+  {   325,   6,   8,   0,   1,   7 },   // 'd'
+  {   331,   5,   6,   0,   3,   6 },   // 'e'
+  {   335,   5,   8,   0,   1,   6 },   // 'f'
+  {   340,   6,   8,   0,   3,   7 },   // 'g'
+  {   346,   7,   8,   0,   1,   8 },   // 'h'
+  {   353,   5,   8,   0,   1,   6 },   // 'i'
+  {   358,   4,  10,   0,   1,   5 },   // 'j'
+  {   363,   6,   8,   0,   1,   7 },   // 'k'
+  {   369,   5,   8,   0,   1,   6 },   // 'l'
+  {   374,   7,   6,   0,   3,   8 },   // 'm'
+  {   380,   7,   6,   0,   3,   8 },   // 'n'
+  {   386,   5,   6,   0,   3,   6 },   // 'o'
+  {   390,   6,   8,   0,   3,   7 },   // 'p'
+  {   396,   6,   8,   0,   3,   7 },   // 'q'
+  {   402,   5,   6,   0,   3,   6 },   // 'r'
+  {   406,   5,   6,   0,   3,   6 },   // 's'
+  {   410,   6,   7,   0,   2,   7 },   // 't'
+  {   416,   7,   6,   0,   3,   8 },   // 'u'
+  {   422,   7,   6,   0,   3,   8 },   // 'v'
+  {   428,   7,   6,   0,   3,   8 },   // 'w'
+  {   434,   6,   6,   0,   3,   7 },   // 'x'
+  {   439,   7,   8,   0,   3,   8 },   // 'y'
+  {   446,   5,   6,   0,   3,   6 },   // 'z'
+  {   450,   3,  10,   0,   1,   4 },   // '{'
+  {   454,   1,   9,   0,   1,   2 },   // '|'
+  {   456,   3,  10,   0,   1,   4 },   // '}'
+  {   460,   5,   2,   0,   5,   6 },   // '~'
+};
+
+const pRANGE PFont12_Ranges[] PROGMEM =
+{
+  // first, last, glyph
+  { 0x0020, 0x007E,    0 },
+};
+
+pFONT PFont12 = {
+  PFont12_Bitmap,
+  PFont12_Glyphs,
+  PFont12_Ranges,
+  1, /* RangeCount */
+  0x003F, /* Fallback */
+  12, /* Height */
+  9, /* Ascent */
+};
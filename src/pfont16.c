@@ -0,0 +1,220 @@
+/**
+ *  @brief      :   PFont16, proportional, generated by tools/fontconv from Font16
+ */
+
+#include "fonts.h"
+#include <avr/pgmspace.h>
+
+const uint8_t PFont16_Bitmap[] PROGMEM =
+{
+  0xFF, 0xFF, 0x30,   // '!'
+  0xEF, 0xDD, 0x12, 0x24, 0x40,   // '"'
+  0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C,   // '#'
+  0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00,   // '$'
+  0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06,   // '%'
+  0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76,   // '&'
+  0xFD, 0x24,   // U+0027
+  0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33,   // '('
+  0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC,   // ')'
+  0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66,   // '*'
+  0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,   // '+'
+  0x6B, 0x48,   // ','
+  0xFE,   // '-'
+  0xF0,   // '.'
+  0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0,   // '/'
+  0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70,   // '0'
+  0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,   // '1'
+  0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xFC,   // '2'
+  0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,   // '3'
+  0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C,   // '4'
+  0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8,   // '5'
+  0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78,   // '6'
+  0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,   // '7'
+  0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8,   // '8'
+  0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0,   // '9'
+  0xF0, 0x3C,   // ':'
+  0x33, 0x00, 0x06, 0x48, 0x80,   // ';'
+  0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x80,   // '<'
+  0xFF, 0x80, 0x3F, 0xE0,   // '='
+  0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x30, 0x20, 0x60, 0xC0, 0x00,   // '>'
+  0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30,   // '?'
+  0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80,   // '@'
+  0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0,   // 'A'
+  0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE,   // 'B'
+  0x3E, 0xB0, 0xF0, 0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00,   // 'C'
+  0xFE, 0x31, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00,   // 'D'
+  0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF,   // 'E'
+  0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00,   // 'F'
+  0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00,   // 'G'
+  0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80,   // 'H'
+  0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,   // 'I'
+  0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00,   // 'J'
+  0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1, 0x98, 0xC6, 0xF3, 0x80,   // 'K'
+  0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61, 0xFF, 0x80,   // 'L'
+  0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06, 0xFB, 0xE0,   // 'M'
+  0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00,   // 'N'
+  0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00,   // 'O'
+  0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC,   // 'P'
+  0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF, 0xC0,   // 'Q'
+  0xFE, 0x18, 0xC6, 0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0,   // 'R'
+  0x7F, 0x8F, 0x1F, 0x07, 0xC1, 0xF1, 0xE3, 0xFC,   // 'S'
+  0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E,   // 'T'
+  0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00,   // 'U'
+  0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00,   // 'V'
+  0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31, 0x80,   // 'W'
+  0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80,   // 'X'
+  0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00,   // 'Y'
+  0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE,   // 'Z'
+  0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF,   // '['
+  0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03,   // U+005C
+  0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F,   // ']'
+  0x10, 0x50, 0xA2, 0x28, 0x30, 0x40,   // '^'
+  0xFF, 0xE0,   // '_'
+  0x88, 0x80,   // '`'
+  0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77,   // 'a'
+  0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73, 0x77, 0x00,   // 'b'
+  0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E,   // 'c'
+  0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0,   // 'd'
+  0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC,   // 'e'
+  0x1F, 0x98, 0x0C, 0x1F, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x7F, 0x00,   // 'f'
+  0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00,   // 'g'
+  0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0,   // 'h'
+  0x18, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,   // 'i'
+  0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xF8,   // 'j'
+  0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0, 0xD8, 0x66, 0x77, 0xC0,   // 'k'
+  0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,   // 'l'
+  0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC,   // 'm'
+  0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE,   // 'n'
+  0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8,   // 'o'
+  0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00,   // 'p'
+  0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0,   // 'q'
+  0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8,   // 'r'
+  0x7F, 0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00,   // 's'
+  0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E,   // 't'
+  0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE,   // 'u'
+  0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0, 0x70,   // 'v'
+  0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60,   // 'w'
+  0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE,   // 'x'
+  0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F, 0x00,   // 'y'
+  0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80,   // 'z'
+  0x36, 0x66, 0x66, 0xC6, 0x66, 0x63,   // '{'
+  0xFF, 0xFF, 0xFF,   // '|'
+  0xC6, 0x66, 0x66, 0x36, 0x66, 0x6C,   // '}'
+  0x61, 0x24, 0x30,   // '~'
+};
+
+const pGLYPH PFont16_Glyphs[] PROGMEM =
+{
+  // offset, width, height, xOffset, yOffset, xAdvance
+  {     0,   0,   0,   0,   0,   6 },   // U+0020
+  {     0,   2,  10,   0,   1,   3 },   // '!'
+  {     3,   7,   5,   0,   2,   8 },   // '"'
+  {     8,   8,  11,   0,   1,   9 },   // '#'
+  {    19,   7,  13,   0,   0,   8 },   // '$'
+  {    31,   8,  10,   0,   1,   9 },   // '%'
+  {    41,   7,   9,   0,   2,   8 },   // '&'
+  {    49,   3,   5,   0,   2,   4 },   // U+0027
+  {    51,   4,  12,   0,   1,   5 },   // '('
+  {    57,   4,  12,   0,   1,   5 },   // ')'
+  {    63,   8,   7,   0,   1,   9 },   // '*'
+  {    70,   7,   7,   0,   3,   8 },   // '+'
+  {    77,   3,   5,   0,   9,   4 },   // ','
+  {    79,   7,   1,   0,   6,   8 },   // '-'
+  {    80,   2,   2,   0,   9,   3 },   // '.'
+  {    81,   8,  13,   0,   0,   9 },   // '/'
+  {    94,   7,  10,   0,   1,   8 },   // '0'
+  {   103,   8,  10,   0,   1,   9 },   // '1'
+  {   113,   7,  10,   0,   1,   8 },   // '2'
+  {   122,   8,  10,   0,   1,   9 },   // '3'
+  {   132,   7,  10,   0,   1,   8 },   // '4'
+  {   141,   7,  10,   0,   1,   8 },   // '5'
+  {   150,   7,  10,   0,   1,   8 },   // '6'
+  {   159,   7,  10,   0,   1,   8 },   // '7'
+  {   168,   7,  10,   0,   1,   8 },   // '8'
+  {   177,   7,  10,   0,   1,   8 },   // '9'
+  {   186,   2,   7,   0,   4,   3 },   // ':'
+  {   188,   4,   9,   0,   4,   5 },   // ';'
+  {   193,   9,   9,   0,   2,  10 },   // '<'
+  {   204,   9,   3,   0,   5,  10 },   // '='
+  {   208,   9,   9,   0,   2,  10 },   // '>'
+  {   219,   7,   9,   0,   2,   8 },   // '?'
+  {   227,   6,  11,   0,   1,   7 },   // '@'
+  {   236,  10,   9,   0,   2,  11 },   // 'A'
+  {   248,   8,   9,   0,   2,   9 },   // 'B'
+  {   257,   9,   9,   0,   2,  10 },   // 'C'
+  {   268,   9,   9,   0,   2,  10 },   // 'D'
+  {   279,   8,   9,   0,   2,   9 },   // 'E'
+  {   288,   9,   9,   0,   2,  10 },   // 'F'
+  {   299,   9,   9,   0,   2,  10 },   // 'G'
+  {   310,   9,   9,   0,   2,  10 },   // 'H'
+  {   321,   8,   9,   0,   2,   9 },   // 'I'
+  {   330,   9,   9,   0,   2,  10 },   // 'J'
+  {   341,   9,   9,   0,   2,  10 },   // 'K'
+  {   352,   9,   9,   0,   2,  10 },   // 'L'
+  {   363,  11,   9,   0,   2,  12 },   // 'M'
+  {   376,   9,   9,   0,   2,  10 },   // 'N'
+  {   387,   9,   9,   0,   2,  10 },   // 'O'
+  {   398,   8,   9,   0,   2,   9 },   // 'P'
+  {   407,   9,  11,   0,   2,  10 },   // 'Q'
+  {   420,  10,   9,   0,   2,  11 },   // 'R'
+  {   432,   7,   9,   0,   2,   8 },   // 'S'
+  {   440,   8,   9,   0,   2,   9 },   // 'T'
+  {   449,   9,   9,   0,   2,  10 },   // 'U'
+  {   460,   9,   9,   0,   2,  10 },   // 'V'
+  {   471,  11,   9,   0,   2,  12 },   // 'W'
+  {   484,   9,   9,   0,   2,  10 },   // 'X'
+  {   495,  10,   9,   0,   2,  11 },   // 'Y'
+  {   507,   7,   9,   0,   2,   8 },   // 'Z'
+  {   515,   4,  12,   0,   1,   5 },   // '['
+  {   521,   8,  13,   0,   0,   9 },   // U+005C
+  {   534,   4,  12,   0,   1,   5 },   // ']'
+  {   540,   7,   6,   0,   0,   8 },   // '^'
+  {   546,  11,   1,   0,  15,  12 },   // '_'
+  {   548,   3,   3,   0,   0,   4 },   // '`'
+  {   550,   8,   7,   0,   4,   9 },   // 'a'
+  {   557,   9,  10,   0,   1,  10 },   // 'b'
+  {   569,   8,   7,   0,   4,   9 },   // 'c'
+  {   576,   9,  10,   0,   1,  10 },   // 'd'
+  {   588,   9,   7,   0,   4,  10 },   // 'e'
+  {   596,   9,  10,   0,   1,  10 },   // 'f'
+  {   608,   9,  10,   0,   4,  10 },   // 'g'
+  {   620,   9,  10,   0,   1,  10 },   // 'h'
+  {   632,   8,  10,   0,   1,   9 },   // 'i'
+  {   642,   6,  13,   0,   1,   7 },   // 'j'
+  {   652,   9,  10,   0,   1,  10 },   // 'k'
+  {   664,   8,  10,   0,   1,   9 },   // 'l'
+  {   674,  10,   7,   0,   4,  11 },   // 'm'
+  {   683,   9,   7,   0,   4,  10 },   // 'n'
+  {   691,   9,   7,   0,   4,  10 },   // 'o'
+  {   699,   9,  10,   0,   4,  10 },   // 'p'
+  {   711,   9,  10,   0,   4,  10 },   // 'q'
+  {   723,   9,   7,   0,   4,  10 },   // 'r'
+  {   731,   7,   7,   0,   4,   8 },   // 's'
+  {   738,   8,  10,   0,   1,   9 },   // 't'
+  {   748,   9,   7,   0,   4,  10 },   // 'u'
+  {   756,   9,   7,   0,   4,  10 },   // 'v'
+  {   764,  11,   7,   0,   4,  12 },   // 'w'
+  {   774,   9,   7,   0,   4,  10 },   // 'x'
+  {   782,  10,  10,   0,   4,  11 },   // 'y'
+  {   795,   7,   7,   0,   4,   8 },   // 'z'
+  {   802,   4,  12,   0,   1,   5 },   // '{'
+  {   808,   2,  12,   0,   1,   3 },   // '|'
+  {   811,   4,  12,   0,   1,   5 },   // '}'
+  {   817,   7,   3,   0,   5,   8 },   // '~'
+};
+
+const pRANGE PFont16_Ranges[] PROGMEM =
+{
+  // first, last, glyph
+  { 0x0020, 0x007E,    0 },
+};
+
+pFONT PFont16 = {
+  PFont16_Bitmap,
+  PFont16_Glyphs,
+  PFont16_Ranges,
+  1, /* RangeCount */
+  0x003F, /* Fallback */
+  16, /* Height */
+  11, /* Ascent */
+};
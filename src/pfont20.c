@@ -0,0 +1,220 @@
+/**
+ *  @brief      :   PFont20, proportional, generated by tools/fontconv from Font20
+ */
+
+#include "fonts.h"
+#include <avr/pgmspace.h>
+
+const uint8_t PFont20_Bitmap[] PROGMEM =
+{
+  0xFF, 0xFF, 0xFA, 0x40, 0x7E,   // '!'
+  0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42,   // '"'
+  0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC,   // '#'
+  0x18, 0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE, 0xFC, 0x18, 0x18, 0x18,   // '$'
+  0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42, 0x21, 0x10, 0x70,   // '%'
+  0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF, 0x60,   // '&'
+  0xFF, 0xA4, 0x80,   // U+0027
+  0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33,   // '('
+  0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC,   // ')'
+  0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,   // '*'
+  0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00,   // '+'
+  0x76, 0x6C, 0xC8,   // ','
+  0xFF, 0xFF, 0xC0,   // '-'
+  0xFF, 0x80,   // '.'
+  0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0,   // '/'
+  0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0,   // '0'
+  0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,   // '1'
+  0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0xF8,   // '2'
+  0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0, 0x3C, 0x1F, 0xFE, 0x7F, 0x00,   // '3'
+  0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0, 0xC1, 0xF0, 0xF8,   // '4'
+  0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9, 0x8E, 0x03, 0x01, 0x80, 0xF0, 0xFF, 0xE7, 0xE0,   // '5'
+  0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8, 0xEF, 0xE1, 0xE0,   // '6'
+  0xFF, 0xFF, 0xF0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0,   // '7'
+  0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0,   // '8'
+  0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83, 0xDF, 0xCF, 0x80,   // '9'
+  0xFF, 0x80, 0x3F, 0xE0,   // ':'
+  0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20,   // ';'
+  0x00, 0x60, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01, 0x80,   // '<'
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,   // '='
+  0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C, 0x1E, 0x03, 0x00, 0x00,   // '>'
+  0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38,   // '?'
+  0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27, 0x80,   // '@'
+  0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC, 0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F,   // 'A'
+  0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8, 0x3F, 0xFF, 0xFE,   // 'B'
+  0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC, 0x73, 0xF8, 0x7C,   // 'C'
+  0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xEC, 0x3B, 0xFE, 0x7F, 0x80,   // 'D'
+  0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8, 0x3F, 0xFF, 0xFF,   // 'E'
+  0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18, 0x0F, 0xC3, 0xF0,   // 'F'
+  0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0, 0xCC, 0x19, 0xFF, 0x0F, 0x80,   // 'G'
+  0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98, 0x6F, 0x3F, 0xCF,   // 'H'
+  0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,   // 'I'
+  0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x73, 0xFC, 0x1F, 0x00,   // 'J'
+  0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63, 0x0C, 0x33, 0xE7, 0xFC, 0x70,   // 'K'
+  0xFC, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC, 0x3F, 0xFF, 0xFF,   // 'L'
+  0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F,   // 'M'
+  0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98, 0xEF, 0xBB, 0xE6,   // 'N'
+  0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78,   // 'O'
+  0xFF, 0x3F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18, 0x0F, 0xC3, 0xF0,   // 'P'
+  0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3, 0x38,   // 'Q'
+  0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61, 0x8C, 0x3B, 0xE3, 0xFC, 0x30,   // 'R'
+  0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0, 0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8, 0x7F, 0xFB, 0x7C,   // 'S'
+  0xFF, 0xFF, 0xFC, 0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC,   // 'T'
+  0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C, 0xE3, 0xF0, 0x78,   // 'U'
+  0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B, 0x01, 0xC0, 0x38, 0x07, 0x00,   // 'V'
+  0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5, 0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0,   // 'W'
+  0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31, 0x8C, 0x1B, 0xC7, 0xF8, 0xF0,   // 'X'
+  0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC,   // 'Y'
+  0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF,   // 'Z'
+  0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,   // '['
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03,   // U+005C
+  0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF,   // ']'
+  0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04,   // '^'
+  0xFF, 0xFF, 0xFF, 0xF0,   // '_'
+  0x86, 0x10,   // '`'
+  0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0,   // 'a'
+  0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60, 0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0,   // 'b'
+  0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00,   // 'c'
+  0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x87, 0x3F, 0xF1, 0xEE,   // 'd'
+  0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D, 0xFF, 0x1F, 0x00,   // 'e'
+  0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x1F, 0xEF, 0xF0,   // 'f'
+  0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0,   // 'g'
+  0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,   // 'h'
+  0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,   // 'i'
+  0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC,   // 'j'
+  0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B, 0x06, 0x63, 0x9F, 0xE7, 0xC0,   // 'k'
+  0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,   // 'l'
+  0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77, 0xF7, 0x70,   // 'm'
+  0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,   // 'n'
+  0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,   // 'o'
+  0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE, 0x6F, 0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80,   // 'p'
+  0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E,   // 'q'
+  0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00,   // 'r'
+  0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC,   // 's'
+  0x30, 0x0C, 0x03, 0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x33, 0xFC, 0x7C,   // 't'
+  0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0,   // 'u'
+  0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E, 0x00,   // 'v'
+  0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31, 0x80,   // 'w'
+  0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0,   // 'x'
+  0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C, 0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0,   // 'y'
+  0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63, 0xFF, 0xFF,   // 'z'
+  0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7,   // '{'
+  0xFF, 0xFF, 0xFF, 0xFF,   // '|'
+  0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38,   // '}'
+  0x38, 0x3F, 0x3C, 0xFC, 0x1E,   // '~'
+};
+
+const pGLYPH PFont20_Glyphs[] PROGMEM =
+{
+  // offset, width, height, xOffset, yOffset, xAdvance
+  {     0,   0,   0,   0,   0,   7 },   // U+0020
+  {     0,   3,  13,   0,   1,   4 },   // '!'
+  {     5,   8,   6,   0,   2,   9 },   // '"'
+  {    11,  10,  16,   0,   0,  11 },   // '#'
+  {    31,   8,  16,   0,   0,   9 },   // '$'
+  {    47,   9,  13,   0,   1,  10 },   // '%'
+  {    62,   9,  11,   0,   3,  10 },   // '&'
+  {    75,   3,   6,   0,   2,   4 },   // U+0027
+  {    78,   4,  16,   0,   1,   5 },   // '('
+  {    86,   4,  16,   0,   1,   5 },   // ')'
+  {    94,   8,   9,   0,   1,   9 },   // '*'
+  {   103,  10,  10,   0,   3,  11 },   // '+'
+  {   116,   4,   6,   0,  11,   5 },   // ','
+  {   119,   9,   2,   0,   7,  10 },   // '-'
+  {   122,   3,   3,   0,  11,   4 },   // '.'
+  {   124,   8,  16,   0,   0,   9 },   // '/'
+  {   140,   9,  13,   0,   1,  10 },   // '0'
+  {   155,   8,  13,   0,   1,   9 },   // '1'
+  {   168,   9,  13,   0,   1,  10 },   // '2'
+  {   183,  10,  13,   0,   1,  11 },   // '3'
+  {   200,   9,  13,   0,   1,  10 },   // '4'
+  {   215,   9,  13,   0,   1,  10 },   // '5'
+  {   230,   9,  13,   0,   1,  10 },   // '6'
+  {   245,   9,  13,   0,   1,  10 },   // '7'
+  {   260,   9,  13,   0,   1,  10 },   // '8'
+  {   275,   9,  13,   0,   1,  10 },   // '9'
+  {   290,   3,   9,   0,   5,   4 },   // ':'
+  {   294,   5,  11,   0,   5,   6 },   // ';'
+  {   301,  11,  11,   0,   3,  12 },   // '<'
+  {   317,  11,   6,   0,   5,  12 },   // '='
+  {   326,  11,  11,   0,   3,  12 },   // '>'
+  {   342,   8,  12,   0,   2,   9 },   // '?'
+  {   354,   7,  14,   0,   1,   8 },   // '@'
+  {   367,  12,  12,   0,   2,  13 },   // 'A'
+  {   385,  10,  12,   0,   2,  11 },   // 'B'
+  {   400,  10,  12,   0,   2,  11 },   // 'C'
+  {   415,  11,  12,   0,   2,  12 },   // 'D'
+  {   432,  10,  12,   0,   2,  11 },   // 'E'
+  {   447,  10,  12,   0,   2,  11 },   // 'F'
+  {   462,  11,  12,   0,   2,  12 },   // 'G'
+  {   479,  10,  12,   0,   2,  11 },   // 'H'
+  {   494,   8,  12,   0,   2,   9 },   // 'I'
+  {   506,  11,  12,   0,   2,  12 },   // 'J'
+  {   523,  11,  12,   0,   2,  12 },   // 'K'
+  {   540,  10,  12,   0,   2,  11 },   // 'L'
+  {   555,  12,  12,   0,   2,  13 },   // 'M'
+  {   573,  10,  12,   0,   2,  11 },   // 'N'
+  {   588,  10,  12,   0,   2,  11 },   // 'O'
+  {   603,  10,  12,   0,   2,  11 },   // 'P'
+  {   618,  10,  15,   0,   2,  11 },   // 'Q'
+  {   637,  11,  12,   0,   2,  12 },   // 'R'
+  {   654,  10,  12,   0,   2,  11 },   // 'S'
+  {   669,  10,  12,   0,   2,  11 },   // 'T'
+  {   684,  10,  12,   0,   2,  11 },   // 'U'
+  {   699,  11,  12,   0,   2,  12 },   // 'V'
+  {   716,  13,  12,   0,   2,  14 },   // 'W'
+  {   736,  11,  12,   0,   2,  12 },   // 'X'
+  {   753,  10,  12,   0,   2,  11 },   // 'Y'
+  {   768,   8,  12,   0,   2,   9 },   // 'Z'
+  {   780,   4,  16,   0,   1,   5 },   // '['
+  {   788,   8,  16,   0,   0,   9 },   // U+005C
+  {   804,   4,  16,   0,   1,   5 },   // ']'
+  {   812,   9,   6,   0,   1,  10 },   // '^'
+  {   819,  14,   2,   0,  18,  15 },   // '_'
+  {   823,   4,   3,   0,   1,   5 },   // '`'
+  {   825,  10,   9,   0,   5,  11 },   // 'a'
+  {   837,  11,  13,   0,   1,  12 },   // 'b'
+  {   855,  10,   9,   0,   5,  11 },   // 'c'
+  {   867,  11,  13,   0,   1,  12 },   // 'd'
+  {   885,  10,   9,   0,   5,  11 },   // 'e'
+  {   897,   9,  13,   0,   1,  10 },   // 'f'
+  {   912,  11,  13,   0,   5,  12 },   // 'g'
+  {   930,  10,  13,   0,   1,  11 },   // 'h'
+  {   947,   8,  13,   0,   1,   9 },   // 'i'
+  {   960,   8,  17,   0,   1,   9 },   // 'j'
+  {   977,  10,  13,   0,   1,  11 },   // 'k'
+  {   994,   8,  13,   0,   1,   9 },   // 'l'
+  {  1007,  12,   9,   0,   5,  13 },   // 'm'
+  {  1021,  10,   9,   0,   5,  11 },   // 'n'
+  {  1033,  10,   9,   0,   5,  11 },   // 'o'
+  {  1045,  11,  13,   0,   5,  12 },   // 'p'
+  {  1063,  11,  13,   0,   5,  12 },   // 'q'
+  {  1081,  10,   9,   0,   5,  11 },   // 'r'
+  {  1093,   8,   9,   0,   5,   9 },   // 's'
+  {  1102,  10,  12,   0,   2,  11 },   // 't'
+  {  1117,  10,   9,   0,   5,  11 },   // 'u'
+  {  1129,  11,   9,   0,   5,  12 },   // 'v'
+  {  1142,  11,   9,   0,   5,  12 },   // 'w'
+  {  1155,  10,   9,   0,   5,  11 },   // 'x'
+  {  1167,  11,  13,   0,   5,  12 },   // 'y'
+  {  1185,   8,   9,   0,   5,   9 },   // 'z'
+  {  1194,   6,  16,   0,   1,   7 },   // '{'
+  {  1206,   2,  16,   0,   1,   3 },   // '|'
+  {  1210,   6,  16,   0,   1,   7 },   // '}'
+  {  1222,  10,   4,   0,   6,  11 },   // '~'
+};
+
+const pRANGE PFont20_Ranges[] PROGMEM =
+{
+  // first, last, glyph
+  { 0x0020, 0x007E,    0 },
+};
+
+pFONT PFont20 = {
+  PFont20_Bitmap,
+  PFont20_Glyphs,
+  PFont20_Ranges,
+  1, /* RangeCount */
+  0x003F, /* Fallback */
+  20, /* Height */
+  14, /* Ascent */
+};
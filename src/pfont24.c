@@ -0,0 +1,220 @@
+/**
+ *  @brief      :   PFont24, proportional, generated by tools/fontconv from Font24
+ */
+
+#include "fonts.h"
+#include <avr/pgmspace.h>
+
+const uint8_t PFont24_Bitmap[] PROGMEM =
+{
+  0xFF, 0xFF, 0xFF, 0xE9, 0x01, 0xF8,   // '!'
+  0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42,   // '"'
+  0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x99, 0xFF, 0xFF, 0xF8, 0xCC, 0x33, 0x1F, 0xFF, 0xFF, 0x99, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98,   // '#'
+  0x0C, 0x06, 0x0F, 0x6F, 0xFC, 0x3E, 0x1F, 0x80, 0xF8, 0x3F, 0x03, 0xF0, 0x7C, 0x3E, 0x3F, 0xFB, 0x78, 0x18, 0x0C, 0x06, 0x03, 0x00,   // '$'
+  0x3C, 0x1F, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0xFF, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0,   // '%'
+  0x1F, 0x87, 0xF1, 0x8C, 0x30, 0x06, 0x00, 0x60, 0x0E, 0x03, 0xE7, 0xEF, 0xF8, 0xF3, 0x0E, 0x3F, 0xF3, 0xEE,   // '&'
+  0xFF, 0xA4, 0x90,   // U+0027
+  0x0C, 0x73, 0x9E, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x30,   // '('
+  0xC3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C, 0xE3, 0x00,   // ')'
+  0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33, 0x0C, 0xC0,   // '*'
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,   // '+'
+  0x39, 0x9C, 0xC6, 0x63, 0x00,   // ','
+  0xFF, 0xFF, 0xF0,   // '-'
+  0xFF, 0xF0,   // '.'
+  0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x00,   // '/'
+  0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x8F, 0xC1, 0xE0,   // '0'
+  0x04, 0x0F, 0x0F, 0xC3, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x3F, 0xFF, 0xFC,   // '1'
+  0x1F, 0x0F, 0xFB, 0x83, 0x60, 0x3C, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x07, 0x01, 0xC0, 0x60, 0x18, 0x06, 0x01, 0xFF, 0xFF, 0xF8,   // '2'
+  0x1E, 0x1F, 0xC6, 0x38, 0x06, 0x01, 0x80, 0xC1, 0xE0, 0x7C, 0x03, 0x80, 0x30, 0x0C, 0x03, 0xC1, 0xFF, 0xE7, 0xE0,   // '3'
+  0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61, 0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3, 0xF8,   // '4'
+  0x7F, 0xCF, 0xF9, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xF3, 0x86, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3C, 0x0D, 0xFF, 0x8F, 0xC0,   // '5'
+  0x07, 0xC7, 0xF3, 0x81, 0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xE1, 0xF0,   // '6'
+  0xFF, 0xFF, 0xFC, 0x0F, 0x07, 0x01, 0x80, 0x60, 0x38, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x18, 0x0E, 0x03, 0x00, 0xC0,   // '7'
+  0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF0, 0xFC, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0,   // '8'
+  0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0, 0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F, 0x80,   // '9'
+  0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0,   // ':'
+  0x3C, 0xF3, 0xC0, 0x00, 0x00, 0x0E, 0x71, 0x86, 0x30, 0x80,   // ';'
+  0x00, 0x1C, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1C,   // '<'
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,   // '='
+  0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00, 0xE0, 0x00,   // '>'
+  0x3E, 0x3F, 0xB0, 0xF8, 0x3C, 0x18, 0x1C, 0x1C, 0x3C, 0x1C, 0x0C, 0x00, 0x00, 0x03, 0x81, 0xC0,   // '?'
+  0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0xC3, 0xF1, 0xFC, 0xEF, 0x33, 0xCC, 0xF3, 0x3C, 0x7F, 0x0F, 0xC0, 0x18, 0x07, 0x0C, 0xFF, 0x1F, 0x00,   // '@'
+  0x1F, 0x80, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0x60, 0x03, 0x60, 0x06, 0x30, 0x06, 0x30, 0x0C, 0x30, 0x0F, 0xF8, 0x1F, 0xF8, 0x18, 0x0C, 0x30, 0x0C, 0xFC, 0x7F, 0xFC, 0x7F,   // 'A'
+  0xFF, 0xC7, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x03, 0x18, 0x38, 0xFF, 0x87, 0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x3F, 0xFF, 0x7F, 0xF0,   // 'B'
+  0x0F, 0xB3, 0xFF, 0x70, 0x76, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x60, 0x37, 0x07, 0x3F, 0xE0, 0xFC,   // 'C'
+  0xFF, 0x87, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x0C, 0x60, 0xEF, 0xFE, 0x7F, 0xE0,   // 'D'
+  0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0, 0x33, 0x03, 0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF,   // 'E'
+  0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0, 0x33, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0,   // 'F'
+  0x0F, 0xB1, 0xFF, 0x9C, 0x1C, 0xC0, 0x6C, 0x03, 0x60, 0x03, 0x00, 0x18, 0x7F, 0xC3, 0xFE, 0x01, 0xB8, 0x0C, 0xE0, 0xE3, 0xFF, 0x07, 0xE0,   // 'G'
+  0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0xFF, 0x0F, 0xFC, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3, 0xF0,   // 'H'
+  0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0,   // 'I'
+  0x1F, 0xF8, 0xFF, 0xC0, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x31, 0x83, 0x0F, 0xF8, 0x1F, 0x00,   // 'J'
+  0xFE, 0x7D, 0xFC, 0xF8, 0xC1, 0x81, 0x86, 0x03, 0x18, 0x06, 0x60, 0x0D, 0xC0, 0x1F, 0xC0, 0x39, 0xC0, 0x61, 0xC0, 0xC1, 0x81, 0x83, 0x8F, 0xE3, 0xFF, 0xC7, 0xC0,   // 'K'
+  0xFF, 0x07, 0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x3F, 0xFF, 0xFF, 0xFC,   // 'L'
+  0xF0, 0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0x6C, 0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30, 0x0C, 0xFE, 0x7F, 0xFE, 0x7F,   // 'M'
+  0xF1, 0xFF, 0xC7, 0xF3, 0x83, 0x0F, 0x0C, 0x3E, 0x30, 0xD8, 0xC3, 0x73, 0x0C, 0xEC, 0x31, 0xB0, 0xC7, 0xC3, 0x0F, 0x0C, 0x1C, 0xFE, 0x33, 0xF8, 0xC0,   // 'N'
+  0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC0, 0xF0,   // 'O'
+  0xFF, 0xCF, 0xFE, 0x30, 0x73, 0x03, 0x30, 0x33, 0x03, 0x30, 0x63, 0xFE, 0x3F, 0x83, 0x00, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0,   // 'P'
+  0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC1, 0xF0, 0x1F, 0x33, 0xFF, 0x30, 0xE0,   // 'Q'
+  0xFF, 0xC3, 0xFF, 0x83, 0x07, 0x0C, 0x0C, 0x30, 0x30, 0xC1, 0xC3, 0xFE, 0x0F, 0xE0, 0x31, 0xC0, 0xC3, 0x83, 0x06, 0x0C, 0x1C, 0xFE, 0x3F, 0xF8, 0x70,   // 'R'
+  0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x3C, 0x0F, 0x87, 0xFF, 0xB7, 0xC0,   // 'S'
+  0xFF, 0xFF, 0xFF, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xC3, 0xFC,   // 'T'
+  0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E, 0x00,   // 'U'
+  0xFE, 0xFF, 0xFD, 0xFC, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x03, 0x18, 0x06, 0x30, 0x06, 0xC0, 0x0D, 0x80, 0x1B, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x20, 0x00,   // 'V'
+  0xFE, 0x3F, 0xFF, 0x1F, 0xCC, 0x01, 0x86, 0x00, 0xC3, 0x08, 0x60, 0xCE, 0x60, 0x67, 0x30, 0x36, 0xD8, 0x1B, 0x6C, 0x0F, 0x3E, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0xC1, 0x80, 0x60, 0xC0,   // 'W'
+  0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x1E, 0x00, 0x30, 0x00, 0xC0, 0x07, 0x80, 0x33, 0x01, 0x86, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3, 0xF0,   // 'X'
+  0xF8, 0xFF, 0xE3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x33, 0x00, 0x78, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80,   // 'Y'
+  0x7F, 0xEF, 0xFD, 0x81, 0xB0, 0x66, 0x18, 0xC6, 0x01, 0x80, 0x60, 0x18, 0x66, 0x0D, 0x81, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,   // 'Z'
+  0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xC0,   // '['
+  0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03,   // U+005C
+  0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFF, 0xC0,   // ']'
+  0x04, 0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01,   // '^'
+  0xFF, 0xFF, 0xFF, 0xFF,   // '_'
+  0xC7, 0x0E, 0x30,   // '`'
+  0x3F, 0x07, 0xF8, 0x00, 0xC0, 0x0C, 0x1F, 0xC7, 0xFC, 0xE0, 0xCC, 0x0C, 0xC1, 0xC7, 0xFF, 0x3E, 0xF0,   // 'a'
+  0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0, 0xC6, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF, 0x00,   // 'b'
+  0x0F, 0xB3, 0xFF, 0x70, 0x7E, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0E, 0x03, 0x70, 0x73, 0xFE, 0x0F, 0xC0,   // 'c'
+  0x01, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0xC1, 0xF6, 0x3F, 0xF1, 0x83, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xFC, 0x7D, 0xE0,   // 'd'
+  0x1F, 0x87, 0xFE, 0x60, 0x6C, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0x60, 0x37, 0xFF, 0x1F, 0xC0,   // 'e'
+  0x07, 0xF0, 0xFF, 0x18, 0x01, 0x80, 0xFF, 0xEF, 0xFE, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0,   // 'f'
+  0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x70, 0xFF, 0x07, 0xE0,   // 'g'
+  0xF0, 0x03, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x37, 0xC0, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0,   // 'h'
+  0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0,   // 'i'
+  0x06, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0xFF, 0xDF, 0x80,   // 'j'
+  0xF0, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x33, 0xE3, 0x3E, 0x33, 0x03, 0x60, 0x3E, 0x03, 0xC0, 0x3E, 0x03, 0x70, 0x33, 0x8F, 0x1F, 0xF1, 0xF0,   // 'k'
+  0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0,   // 'l'
+  0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF,   // 'm'
+  0xF7, 0xC3, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0,   // 'n'
+  0x0F, 0x03, 0xFC, 0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x0F, 0x00,   // 'o'
+  0xF7, 0xC7, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x38, 0x31, 0xFF, 0x8D, 0xF0, 0x60, 0x03, 0x00, 0x18, 0x03, 0xF8, 0x1F, 0xC0,   // 'p'
+  0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x0F, 0xE0, 0x7F,   // 'q'
+  0xF9, 0xEF, 0xBF, 0x1F, 0x31, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0,   // 'r'
+  0x3F, 0xDF, 0xFC, 0x0F, 0x03, 0xFC, 0x1F, 0xE0, 0x7F, 0x03, 0xC1, 0xFF, 0xEF, 0xF0,   // 's'
+  0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0xFF, 0xCF, 0xFC, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x71, 0xFF, 0x0F, 0xC0,   // 't'
+  0xF0, 0xF3, 0xC3, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0x7F, 0xF0, 0xFB, 0xC0,   // 'u'
+  0xF8, 0x7F, 0xE1, 0xF3, 0x03, 0x0C, 0x0C, 0x18, 0x60, 0x61, 0x80, 0xCC, 0x03, 0x30, 0x0F, 0xC0, 0x1E, 0x00, 0x78, 0x00,   // 'v'
+  0xF0, 0x7F, 0x83, 0xD8, 0x8C, 0xCE, 0x66, 0x73, 0x1A, 0xB0, 0xF7, 0x87, 0xBC, 0x38, 0xC0, 0xC6, 0x06, 0x30,   // 'w'
+  0xF9, 0xFF, 0x9F, 0x30, 0xC1, 0x98, 0x0F, 0x00, 0x60, 0x0F, 0x01, 0x98, 0x30, 0xCF, 0x9F, 0xF9, 0xF0,   // 'x'
+  0xFC, 0x3F, 0xF8, 0x7C, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x01, 0x8C, 0x03, 0x18, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0,   // 'y'
+  0xFF, 0xFF, 0xFC, 0x1B, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC3, 0x60, 0xFF, 0xFF, 0xFC,   // 'z'
+  0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30, 0xC3, 0x0C, 0x3C, 0x70,   // '{'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0,   // '|'
+  0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x38, 0x73, 0x8C, 0x30, 0xC3, 0x0C, 0xF3, 0x80,   // '}'
+  0x38, 0x0F, 0x8F, 0xBB, 0xE3, 0xE0, 0x38,   // '~'
+};
+
+const pGLYPH PFont24_Glyphs[] PROGMEM =
+{
+  // offset, width, height, xOffset, yOffset, xAdvance
+  {     0,   0,   0,   0,   0,   9 },   // U+0020
+  {     0,   3,  15,   0,   2,   4 },   // '!'
+  {     6,   8,   7,   0,   3,   9 },   // '"'
+  {    13,  11,  16,   0,   2,  12 },   // '#'
+  {    35,   9,  19,   0,   1,  10 },   // '$'
+  {    57,  10,  15,   0,   2,  11 },   // '%'
+  {    76,  11,  13,   0,   4,  12 },   // '&'
+  {    94,   3,   7,   0,   3,   4 },   // U+0027
+  {    97,   6,  18,   0,   2,   7 },   // '('
+  {   111,   6,  18,   0,   2,   7 },   // ')'
+  {   125,  10,  10,   0,   2,  11 },   // '*'
+  {   138,  12,  12,   0,   4,  13 },   // '+'
+  {   156,   5,   7,   0,  14,   6 },   // ','
+  {   161,  10,   2,   0,   9,  11 },   // '-'
+  {   164,   4,   3,   0,  14,   5 },   // '.'
+  {   166,  10,  20,   0,   0,  11 },   // '/'
+  {   191,  10,  15,   0,   2,  11 },   // '0'
+  {   210,  10,  15,   0,   2,  11 },   // '1'
+  {   229,  11,  15,   0,   2,  12 },   // '2'
+  {   250,  10,  15,   0,   2,  11 },   // '3'
+  {   269,  11,  15,   0,   2,  12 },   // '4'
+  {   290,  11,  15,   0,   2,  12 },   // '5'
+  {   311,  10,  15,   0,   2,  11 },   // '6'
+  {   330,  10,  15,   0,   2,  11 },   // '7'
+  {   349,  10,  15,   0,   2,  11 },   // '8'
+  {   368,  10,  15,   0,   2,  11 },   // '9'
+  {   387,   4,  11,   0,   6,   5 },   // ':'
+  {   393,   6,  13,   0,   6,   7 },   // ';'
+  {   403,  14,  13,   0,   4,  15 },   // '<'
+  {   426,  13,   6,   0,   7,  14 },   // '='
+  {   436,  14,  13,   0,   4,  15 },   // '>'
+  {   459,   9,  14,   0,   3,  10 },   // '?'
+  {   475,  10,  17,   0,   2,  11 },   // '@'
+  {   497,  16,  14,   0,   3,  17 },   // 'A'
+  {   525,  13,  14,   0,   3,  14 },   // 'B'
+  {   548,  12,  14,   0,   3,  13 },   // 'C'
+  {   569,  13,  14,   0,   3,  14 },   // 'D'
+  {   592,  12,  14,   0,   3,  13 },   // 'E'
+  {   613,  12,  14,   0,   3,  13 },   // 'F'
+  {   634,  13,  14,   0,   3,  14 },   // 'G'
+  {   657,  14,  14,   0,   3,  15 },   // 'H'
+  {   682,  10,  14,   0,   3,  11 },   // 'I'
+  {   700,  13,  14,   0,   3,  14 },   // 'J'
+  {   723,  15,  14,   0,   3,  16 },   // 'K'
+  {   750,  13,  14,   0,   3,  14 },   // 'L'
+  {   773,  16,  14,   0,   3,  17 },   // 'M'
+  {   801,  14,  14,   0,   3,  15 },   // 'N'
+  {   826,  12,  14,   0,   3,  13 },   // 'O'
+  {   847,  12,  14,   0,   3,  13 },   // 'P'
+  {   868,  12,  17,   0,   3,  13 },   // 'Q'
+  {   894,  14,  14,   0,   3,  15 },   // 'R'
+  {   919,  10,  14,   0,   3,  11 },   // 'S'
+  {   937,  12,  14,   0,   3,  13 },   // 'T'
+  {   958,  14,  14,   0,   3,  15 },   // 'U'
+  {   983,  15,  14,   0,   3,  16 },   // 'V'
+  {  1010,  17,  14,   0,   3,  18 },   // 'W'
+  {  1040,  14,  14,   0,   3,  15 },   // 'X'
+  {  1065,  14,  14,   0,   3,  15 },   // 'Y'
+  {  1090,  11,  14,   0,   3,  12 },   // 'Z'
+  {  1110,   5,  18,   0,   2,   6 },   // '['
+  {  1122,  10,  20,   0,   0,  11 },   // U+005C
+  {  1147,   5,  18,   0,   2,   6 },   // ']'
+  {  1159,  11,   8,   0,   1,  12 },   // '^'
+  {  1170,  16,   2,   0,  22,  17 },   // '_'
+  {  1174,   5,   4,   0,   1,   6 },   // '`'
+  {  1177,  12,  11,   0,   6,  13 },   // 'a'
+  {  1194,  13,  15,   0,   2,  14 },   // 'b'
+  {  1219,  12,  11,   0,   6,  13 },   // 'c'
+  {  1236,  13,  15,   0,   2,  14 },   // 'd'
+  {  1261,  12,  11,   0,   6,  13 },   // 'e'
+  {  1278,  12,  15,   0,   2,  13 },   // 'f'
+  {  1301,  13,  16,   0,   6,  14 },   // 'g'
+  {  1327,  14,  15,   0,   2,  15 },   // 'h'
+  {  1354,  12,  15,   0,   2,  13 },   // 'i'
+  {  1377,   9,  20,   0,   2,  10 },   // 'j'
+  {  1400,  12,  15,   0,   2,  13 },   // 'k'
+  {  1423,  12,  15,   0,   2,  13 },   // 'l'
+  {  1446,  16,  11,   0,   6,  17 },   // 'm'
+  {  1468,  14,  11,   0,   6,  15 },   // 'n'
+  {  1488,  12,  11,   0,   6,  13 },   // 'o'
+  {  1505,  13,  16,   0,   6,  14 },   // 'p'
+  {  1531,  13,  16,   0,   6,  14 },   // 'q'
+  {  1557,  12,  11,   0,   6,  13 },   // 'r'
+  {  1574,  10,  11,   0,   6,  11 },   // 's'
+  {  1588,  12,  15,   0,   2,  13 },   // 't'
+  {  1611,  14,  11,   0,   6,  15 },   // 'u'
+  {  1631,  14,  11,   0,   6,  15 },   // 'v'
+  {  1651,  13,  11,   0,   6,  14 },   // 'w'
+  {  1669,  12,  11,   0,   6,  13 },   // 'x'
+  {  1686,  15,  16,   0,   6,  16 },   // 'y'
+  {  1716,  10,  11,   0,   6,  11 },   // 'z'
+  {  1730,   6,  18,   0,   2,   7 },   // '{'
+  {  1744,   2,  18,   0,   2,   3 },   // '|'
+  {  1749,   6,  18,   0,   2,   7 },   // '}'
+  {  1763,  11,   5,   0,   8,  12 },   // '~'
+};
+
+const pRANGE PFont24_Ranges[] PROGMEM =
+{
+  // first, last, glyph
+  { 0x0020, 0x007E,    0 },
+};
+
+pFONT PFont24 = {
+  PFont24_Bitmap,
+  PFont24_Glyphs,
+  PFont24_Ranges,
+  1, /* RangeCount */
+  0x003F, /* Fallback */
+  24, /* Height */
+  17, /* Ascent */
+};
@@ -0,0 +1,220 @@
+/**
+ *  @brief      :   PFont8, proportional, generated by tools/fontconv from Font8
+ */
+
+#include "fonts.h"
+#include <avr/pgmspace.h>
+
+const uint8_t PFont8_Bitmap[] PROGMEM =
+{
+  0xF4,   // '!'
+  0xB4,   // '"'
+  0x2A, 0xBE, 0xAF, 0xAA, 0x80,   // '#'
+  0x4F, 0x33, 0x90,   // '$'
+  0x44, 0x3C, 0x22,   // '%'
+  0x74, 0xCA, 0xF0,   // '&'
+  0xE0,   // U+0027
+  0x6A, 0xA4,   // '('
+  0x95, 0x58,   // ')'
+  0x5D, 0x50,   // '*'
+  0x21, 0x3E, 0x42, 0x00,   // '+'
+  0x68,   // ','
+  0xE0,   // '-'
+  0x80,   // '.'
+  0x12, 0x22, 0x44, 0x80,   // '/'
+  0x56, 0xDA, 0x80,   // '0'
+  0x61, 0x08, 0x42, 0x7C,   // '1'
+  0x55, 0x29, 0xC0,   // '2'
+  0x54, 0xA3, 0x80,   // '3'
+  0x26, 0xAF, 0x27,   // '4'
+  0xF3, 0x1A, 0x80,   // '5'
+  0x73, 0x5B, 0x80,   // '6'
+  0xF4, 0xA4, 0x80,   // '7'
+  0x55, 0x5A, 0x80,   // '8'
+  0x76, 0xB3, 0x80,   // '9'
+  0x90,   // ':'
+  0x46,   // ';'
+  0x12, 0xC2, 0x10,   // '<'
+  0xE3, 0x80,   // '='
+  0x84, 0x34, 0x80,   // '>'
+  0x54, 0xA0, 0x80,   // '?'
+  0x69, 0x9B, 0x98, 0x70,   // '@'
+  0x61, 0x14, 0xE8, 0xEC,   // 'A'
+  0xF2, 0x5C, 0x94, 0xF8,   // 'B'
+  0xF6, 0x48, 0xC0,   // 'C'
+  0xF2, 0x52, 0x94, 0xF8,   // 'D'
+  0xFA, 0x58, 0x84, 0xFC,   // 'E'
+  0xFA, 0x58, 0x84, 0x70,   // 'F'
+  0xE8, 0x8B, 0xA6,   // 'G'
+  0xEA, 0x5E, 0x94, 0xF4,   // 'H'
+  0xE9, 0x25, 0xC0,   // 'I'
+  0x72, 0x2A, 0xA4,   // 'J'
+  0xDA, 0x98, 0xE5, 0x6C,   // 'K'
+  0xE2, 0x10, 0x84, 0xFC,   // 'L'
+  0xDE, 0xF7, 0x58, 0xEC,   // 'M'
+  0xDB, 0x5A, 0xB5, 0xF4,   // 'N'
+  0x69, 0x99, 0x96,   // 'O'
+  0xF2, 0x52, 0xE4, 0x70,   // 'P'
+  0x69, 0x99, 0x96, 0x30,   // 'Q'
+  0xF2, 0x52, 0xE4, 0xF4,   // 'R'
+  0xF5, 0x1B, 0xC0,   // 'S'
+  0xFD, 0x48, 0x42, 0x38,   // 'T'
+  0xDA, 0x52, 0x94, 0x98,   // 'U'
+  0xDC, 0x52, 0xA5, 0x18,   // 'V'
+  0xDC, 0x6B, 0x5A, 0xA8,   // 'W'
+  0xDA, 0x88, 0x45, 0x6C,   // 'X'
+  0xDC, 0x54, 0x42, 0x38,   // 'Y'
+  0xF9, 0x24, 0x9F,   // 'Z'
+  0xEA, 0xAC,   // '['
+  0x84, 0x42, 0x22, 0x10,   // U+005C
+  0xD5, 0x5C,   // ']'
+  0x4A, 0x80,   // '^'
+  0xF8,   // '_'
+  0x90,   // '`'
+  0x62, 0xEF,   // 'a'
+  0xC2, 0x1C, 0x94, 0xF8,   // 'b'
+  0xF2, 0x70,   // 'c'
+  0x31, 0x79, 0x97,   // 'd'
+  0xFE, 0x30,   // 'e'
+  0x2B, 0xA5, 0xC0,   // 'f'
+  0x79, 0x97, 0x16,   // 'g'
+  0xC2, 0x1C, 0x94, 0xF4,   // 'h'
+  0x43, 0x25, 0xC0,   // 'i'
+  0x43, 0x92, 0x4F,   // 'j'
+  0xC2, 0x16, 0xE5, 0x6C,   // 'k'
+  0xC9, 0x25, 0xC0,   // 'l'
+  0xD5, 0x6B, 0x50,   // 'm'
+  0xF2, 0x53, 0x90,   // 'n'
+  0x69, 0x96,   // 'o'
+  0xF2, 0x52, 0xE4, 0x70,   // 'p'
+  0x79, 0x97, 0x13,   // 'q'
+  0xF4, 0x4E,   // 'r'
+  0x68, 0xE0,   // 's'
+  0x47, 0x90, 0x93, 0x00,   // 't'
+  0xDA, 0x52, 0x70,   // 'u'
+  0xCA, 0x4C, 0x60,   // 'v'
+  0xDD, 0x6A, 0xA0,   // 'w'
+  0x96, 0x69,   // 'x'
+  0xDA, 0x94, 0x42, 0x30,   // 'y'
+  0xFA, 0x5F,   // 'z'
+  0x29, 0x64, 0x88,   // '{'
+  0xFE,   // '|'
+  0x89, 0x34, 0xA0,   // '}'
+  0x5A,   // '~'
+};
+
+const pGLYPH PFont8_Glyphs[] PROGMEM =
+{
+  // offset, width, height, xOffset, yOffset, xAdvance
+  {     0,   0,   0,   0,   0,   3 },   // U+0020
+  {     0,   1,   6,   0,   0,   2 },   // '!'
+  {     1,   3,   2,   0,   0,   4 },   // '"'
+  {     2,   5,   7,   0,   0,   6 },   // '#'
+  {     7,   3,   7,   0,   0,   4 },   // '$'
+  {    10,   4,   6,   0,   0,   5 },   // '%'
+  {    13,   4,   5,   0,   1,   5 },   // '&'
+  {    16,   1,   3,   0,   0,   2 },   // U+0027
+  {    17,   2,   7,   0,   0,   3 },   // '('
+  {    19,   2,   7,   0,   0,   3 },   // ')'
+  {    21,   3,   4,   0,   0,   4 },   // '*'
+  {    23,   5,   5,   0,   1,   6 },   // '+'
+  {    27,   2,   3,   0,   4,   3 },   // ','
+  {    28,   3,   1,   0,   3,   4 },   // '-'
+  {    29,   1,   1,   0,   5,   2 },   // '.'
+  {    30,   4,   7,   0,   0,   5 },   // '/'
+  {    34,   3,   6,   0,   0,   4 },   // '0'
+  {    37,   5,   6,   0,   0,   6 },   // '1'
+  {    41,   3,   6,   0,   0,   4 },   // '2'
+  {    44,   3,   6,   0,   0,   4 },   // '3'
+  {    47,   4,   6,   0,   0,   5 },   // '4'
+  {    50,   3,   6,   0,   0,   4 },   // '5'
+  {    53,   3,   6,   0,   0,   4 },   // '6'
+  {    56,   3,   6,   0,   0,   4 },   // '7'
+  {    59,   3,   6,   0,   0,   4 },   // '8'
+  {    62,   3,   6,   0,   0,   4 },   // '9'
+  {    65,   1,   4,   0,   2,   2 },   // ':'
+  {    66,   2,   4,   0,   2,   3 },   // ';'
+  {    67,   4,   5,   0,   1,   5 },   // '<'
+  {    70,   3,   3,   0,   1,   4 },   // '='
+  {    72,   4,   5,   0,   1,   5 },   // '>'
+  {    75,   3,   6,   0,   0,   4 },   // '?'
+  {    78,   4,   7,   0,   0,   5 },   // '@'
+  {    82,   5,   6,   0,   0,   6 },   // 'A'
+  {    86,   5,   6,   0,   0,   6 },   // 'B'
+  {    90,   3,   6,   0,   0,   4 },   // 'C'
+  {    93,   5,   6,   0,   0,   6 },   // 'D'
+  {    97,   5,   6,   0,   0,   6 },   // 'E'
+  {   101,   5,   6,   0,   0,   6 },   // 'F'
+  {   105,   4,   6,   0,   0,   5 },   // 'G'
+  {   108,   5,   6,   0,   0,   6 },   // 'H'
+  {   112,   3,   6,   0,   0,   4 },   // 'I'
+  {   115,   4,   6,   0,   0,   5 },   // 'J'
+  {   118,   5,   6,   0,   0,   6 },   // 'K'
+  {   122,   5,   6,   0,   0,   6 },   // 'L'
+  {   126,   5,   6,   0,   0,   6 },   // 'M'
+  {   130,   5,   6,   0,   0,   6 },   // 'N'
+  {   134,   4,   6,   0,   0,   5 },   // 'O'
+  {   137,   5,   6,   0,   0,   6 },   // 'P'
+  {   141,   4,   7,   0,   0,   5 },   // 'Q'
+  {   145,   5,   6,   0,   0,   6 },   // 'R'
+  {   149,   3,   6,   0,   0,   4 },   // 'S'
+  {   152,   5,   6,   0,   0,   6 },   // 'T'
+  {   156,   5,   6,   0,   0,   6 },   // 'U'
+  {   160,   5,   6,   0,   0,   6 },   // 'V'
+  {   164,   5,   6,   0,   0,   6 },   // 'W'
+  {   168,   5,   6,   0,   0,   6 },   // 'X'
+  {   172,   5,   6,   0,   0,   6 },   // 'Y'
+  {   176,   4,   6,   0,   0,   5 },   // 'Z'
+  {   179,   2,   7,   0,   0,   3 },   // '['
+  {   181,   4,   7,   0,   0,   5 },   // U+005C
+  {   185,   2,   7,   0,   0,   3 },   // ']'
+  {   187,   3,   3,   0,   0,   4 },   // '^'
+  {   189,   5,   1,   0,   7,   6 },   // '_'
+  {   190,   2,   2,   0,   0,   3 },   // '`'
+  {   191,   4,   4,   0,   2,   5 },   // 'a'
+  {   193,   5,   6,   0,   0,   6 },   // 'b'
+  {   197,   3,   4,   0,   2,   4 },   // 'c'
+  {   199,   4,   6,   0,   0,   5 },   // 'd'
+  {   202,   3,   4,   0,   2,   4 },   // 'e'
+  {   204,   3,   6,   0,   0,   4 },   // 'f'
+  {   207,   4,   6,   0,   2,   5 },   // 'g'
+  {   210,   5,   6,   0,   0,   6 },   // 'h'
+  {   214,   3,   6,   0,   0,   4 },   // 'i'
+  {   217,   3,   8,   0,   0,   4 },   // 'j'
+  {   220,   5,   6,   0,   0,   6 },   // 'k'
+  {   224,   3,   6,   0,   0,   4 },   // 'l'
+  {   227,   5,   4,   0,   2,   6 },   // 'm'
+  {   230,   5,   4,   0,   2,   6 },   // 'n'
+  {   233,   4,   4,   0,   2,   5 },   // 'o'
+  {   235,   5,   6,   0,   2,   6 },   // 'p'
+  {   239,   4,   6,   0,   2,   5 },   // 'q'
+  {   242,   4,   4,   0,   2,   5 },   // 'r'
+  {   244,   3,   4,   0,   2,   4 },   // 's'
+  {   246,   5,   5,   0,   1,   6 },   // 't'
+  {   250,   5,   4,   0,   2,   6 },   // 'u'
+  {   253,   5,   4,   0,   2,   6 },   // 'v'
+  {   256,   5,   4,   0,   2,   6 },   // 'w'
+  {   259,   4,   4,   0,   2,   5 },   // 'x'
+  {   261,   5,   6,   0,   2,   6 },   // 'y'
+  {   265,   4,   4,   0,   2,   5 },   // 'z'
+  {   267,   3,   7,   0,   0,   4 },   // '{'
+  {   270,   1,   7,   0,   0,   2 },   // '|'
+  {   271,   3,   7,   0,   0,   4 },   // '}'
+  {   274,   4,   2,   0,   3,   5 },   // '~'
+};
+
+const pRANGE PFont8_Ranges[] PROGMEM =
+{
+  // first, last, glyph
+  { 0x0020, 0x007E,    0 },
+};
+
+pFONT PFont8 = {
+  PFont8_Bitmap,
+  PFont8_Glyphs,
+  PFont8_Ranges,
+  1, /* RangeCount */
+  0x003F, /* Fallback */
+  8, /* Height */
+  6, /* Ascent */
+};
@@ -0,0 +1,121 @@
+/**
+ *  @filename   :   band-test.cpp
+ *  @brief      :   DisplayFrame() from display lists shows the same pixels
+ *                  as the same drawing sent in full planes, on every panel,
+ *                  in all orientations and with bands that don't divide
+ *                  the height.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#define EPD_MULTI_PANEL
+
+#include <SPI.h>
+#include "epd1in54b.h"
+#include "epd2in13b.h"
+#include "epd2in7b.h"
+#include "epd2in9b.h"
+#include "epd4in2b.h"
+#include "epd7in5b.h"
+#include "epdsim.h"
+#include "check.h"
+
+static unsigned char black[640 * 384 / 8];
+static unsigned char red[640 * 384 / 8];
+static unsigned char band[2 * 640 / 8 * 64];
+static unsigned char listBlack[4096];
+static unsigned char listRed[1024];
+static EPDSIM_COLOR expected[640 * 384];
+
+static const ORIENTATION orientations[] = { PORTRAIT, LANDSCAPE, PORTRAIT_FLIPPED, LANDSCAPE_FLIPPED };
+
+/**
+ *  @brief: the same drawing on a Paint or recorded in a DisplayList
+ */
+template <class Target>
+static void Scene(Target& target, int16_t w, int16_t h, int16_t ink, bool isRed) {
+  if (!isRed) {
+    for (int16_t y = 0; y < h; y += 14) target.DrawStringAt(2, y, "Bands 0123456789 over the edge", &Font12, ink);
+    target.DrawStringAt(7, h / 3, "Proportional", &PFont16, ink);
+    target.DrawLine(0, 0, w - 1, h - 1, ink);
+    target.DrawCircle(w / 2, h / 2, w / 3, ink);
+    target.DrawRectangle(3, 3, w - 4, h - 4, ink);
+  }
+  else {
+    target.DrawFilledRectangle(w / 4, h / 2, w / 2, h / 2 + 21, ink);
+    target.DrawFilledCircle(3 * w / 4, h / 4, w / 8, ink);
+    target.DrawStringAt(1, h - 26, "RED", &Font24, ink);
+    target.DrawVerticalLine(w - 10, 0, h, ink);
+    target.DrawHorizontalLine(0, h / 5, w, ink);
+    target.DrawPixel(w - 1, h - 1, ink);
+  }
+}
+
+template <class E, class Traits>
+static void Compare(const char* panel) {
+  const int16_t width = Traits::WIDTH;
+  const int16_t height = Traits::HEIGHT;
+  // planes clear to set bits except on the 2.7", the 7.5" takes 1bpp planes as well
+  const int16_t white = Traits::CLEAR_RED & 1;
+  const int32_t plane = (int32_t)width / 8 * height;
+  const int32_t perRow = (Traits::PIXEL_FORMAT == EPD_4BPP ? 2 : 1) * width / 8;
+  static const int16_t rows[] = { 1, 7, 64 };
+  E epd;
+
+  SimPanel.Configure<Traits>();
+  SimPanel.Timing().refreshUs = 1000;
+  CHECK(epd.Init());
+
+  for (int o = 0; o < 4; o++) {
+    Paint paintBlack(black, width, height, orientations[o]);
+    Paint paintRed(red, width, height, orientations[o]);
+    int16_t w = paintBlack.GetWidth();
+    int16_t h = paintBlack.GetHeight();
+
+    memset(black, white ? 0xFF : 0x00, plane);
+    memset(red, white ? 0xFF : 0x00, plane);
+    Scene(paintBlack, w, h, !white, false);
+    Scene(paintRed, w, h, !white, true);
+    CHECK(epd.DisplayFrame(black, red));
+    epd.WaitUntilIdle();
+    for (int16_t y = 0; y < height; y++) {
+      for (int16_t x = 0; x < width; x++) expected[y * width + x] = SimPanel.GetPixel(x, y);
+    }
+
+    DisplayList displayBlack(listBlack, sizeof(listBlack), orientations[o]);
+    DisplayList displayRed(listRed, sizeof(listRed), orientations[o]);
+    Scene(displayBlack, w, h, !white, false);
+    Scene(displayRed, w, h, !white, true);
+    CHECK(!displayBlack.isOverflowed() && !displayRed.isOverflowed());
+
+    for (size_t r = 0; r < sizeof(rows) / sizeof(rows[0]); r++) {
+      // all black first, so a band that isn't sent shows
+      memset(black, white ? 0x00 : 0xFF, plane);
+      memset(red, white ? 0xFF : 0x00, plane);
+      CHECK(epd.DisplayFrame(black, red));
+      epd.WaitUntilIdle();
+      CHECK(epd.DisplayFrame(displayBlack, displayRed, band, rows[r] * perRow));
+      epd.WaitUntilIdle();
+
+      int wrong = 0;
+      for (int16_t y = 0; y < height; y++) {
+        for (int16_t x = 0; x < width; x++) wrong += SimPanel.GetPixel(x, y) != expected[y * width + x];
+      }
+      if (wrong > 0) fprintf(stderr, "%s orientation %d, %d rows: %d pixels differ\n", panel, orientations[o], rows[r], wrong);
+      CHECK(wrong == 0);
+    }
+  }
+  CHECK(SimPanel.GetViolations() == 0);
+}
+
+int main(void) {
+  Compare<Epd1in54b, Epd1in54bTraits>("1in54b");
+  Compare<Epd2in13b, Epd2in13bTraits>("2in13b");
+  Compare<Epd2in7b, Epd2in7bTraits>("2in7b");
+  Compare<Epd2in9b, Epd2in9bTraits>("2in9b");
+  Compare<Epd4in2b, Epd4in2bTraits>("4in2b");
+  Compare<Epd7in5b, Epd7in5bTraits>("7in5b");
+  return CHECK_RESULT();
+}
+
+/* END OF FILE */
@@ -0,0 +1,29 @@
+/**
+ *  @filename   :   check.h
+ *  @brief      :   Assertions of the host tests, a failed CHECK() prints
+ *                  where and the test returns CHECK_RESULT() non zero.
+ *                  Built with CMakeLists.txt and run by ctest.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      checkFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_RESULT()  (checkFailures == 0 ? 0 : 1)
+
+#endif /* CHECK_H */
+
+/* END OF FILE */
@@ -0,0 +1,194 @@
+/**
+ *  @filename   :   diff-test.cpp
+ *  @brief      :   EpdDiffPlane() on rows whose tail is shorter than a
+ *                  32 bit word and on unaligned buffers, PaintRegion
+ *                  merging beyond PAINT_DIRTY_RECTS, and a shadowed
+ *                  panel that skips frames identical to what it shows,
+ *                  also after a NULL window cleared part of it.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <stdlib.h>
+#include <SPI.h>
+#include "epd4in2b.h"
+#include "epddiff.h"
+#include "epdsim.h"
+#include "check.h"
+
+#define ROWS 3
+
+static unsigned char a[64 * ROWS + 4];
+static unsigned char b[64 * ROWS + 4];
+
+static bool Covers(const PaintRegion& region, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  for (uint8_t i = 0; i < region.GetCount(); i++) {
+    const PaintRect& r = region.Get(i);
+    if (x0 >= r.x0 && x1 <= r.x1 && y0 >= r.y0 && y1 <= r.y1) return true;
+  }
+  return false;
+}
+
+static bool Aligned(const PaintRegion& region) {
+  for (uint8_t i = 0; i < region.GetCount(); i++) {
+    const PaintRect& r = region.Get(i);
+    if ((r.x0 & 7) != 0 || (r.x1 & 7) != 7) return false;
+  }
+  return true;
+}
+
+/**
+ *  @brief: one or two changed bytes at every position of rows 1 to 11
+ *          bytes long, at every alignment of the buffers
+ */
+static void Diff(void) {
+  PaintRegion changes;
+
+  for (int16_t stride = 1; stride <= 11; stride++) {
+    for (int offset = 0; offset < 4; offset++) {
+      unsigned char* image = a + offset;
+      unsigned char* shadow = b + (3 - offset);
+
+      for (int i = 0; i < stride * ROWS; i++) image[i] = shadow[i] = (unsigned char)(i * 37);
+      CHECK(!EpdDiffPlane(image, shadow, stride, ROWS, changes));
+      CHECK(changes.GetCount() == 0);
+
+      for (int16_t first = 0; first < stride; first++) {
+        for (int16_t last = first; last < stride; last++) {
+          image[stride + first] ^= 0x01;
+          if (last != first) image[stride + last] ^= 0x80;
+
+          CHECK(EpdDiffPlane(image, shadow, stride, ROWS, changes));
+          CHECK(changes.GetCount() == 1);
+          const PaintRect& r = changes.Get(0);
+          CHECK(r.x0 == first * 8 && r.x1 == last * 8 + 7 && r.y0 == 1 && r.y1 == 1);
+
+          image[stride + first] ^= 0x01;
+          if (last != first) image[stride + last] ^= 0x80;
+        }
+      }
+    }
+  }
+
+  // the last byte of the last row, then rows joining it into one rectangle
+  for (int i = 0; i < 10 * ROWS; i++) a[i] = b[i] = 0xFF;
+  a[10 * ROWS - 1] = 0xFE;
+  CHECK(EpdDiffPlane(a, b, 10, ROWS, changes));
+  CHECK(changes.GetCount() == 1 && changes.Get(0).x0 == 72 && changes.Get(0).y0 == ROWS - 1);
+  a[0] = 0x7F;
+  a[10] = 0x00;
+  a[19] = 0x00;
+  CHECK(EpdDiffPlane(a, b, 10, ROWS, changes));
+  CHECK(changes.GetCount() == 1);
+  CHECK(changes.Get(0).x0 == 0 && changes.Get(0).x1 == 79 && changes.Get(0).y0 == 0 && changes.Get(0).y1 == ROWS - 1);
+}
+
+/**
+ *  @brief: rectangles are widened to bytes, merged with what they touch,
+ *          and beyond PAINT_DIRTY_RECTS with the one that grows least
+ */
+static void Region(void) {
+  PaintRegion region;
+
+  region.Add(3, 4, 9, 5);
+  CHECK(region.GetCount() == 1);
+  CHECK(region.Get(0).x0 == 0 && region.Get(0).x1 == 15 && region.Get(0).y0 == 4 && region.Get(0).y1 == 5);
+  region.Add(8, 5, 12, 5);            // inside
+  CHECK(region.GetCount() == 1 && region.Get(0).x1 == 15);
+  region.Add(16, 6, 16, 6);           // touches the corner
+  CHECK(region.GetCount() == 1 && region.Get(0).x1 == 23 && region.Get(0).y1 == 6);
+
+  // four apart, then one next to the second
+  region.Clear();
+  region.Add(0, 0, 7, 7);
+  region.Add(200, 0, 207, 7);
+  region.Add(0, 200, 7, 207);
+  region.Add(200, 200, 207, 207);
+  CHECK(region.GetCount() == PAINT_DIRTY_RECTS);
+  region.Add(200, 20, 207, 27);
+  CHECK(region.GetCount() == PAINT_DIRTY_RECTS);
+  CHECK(Covers(region, 200, 0, 207, 27));
+  CHECK(!Covers(region, 0, 0, 207, 7));
+  CHECK(Covers(region, 0, 0, 7, 7) && Covers(region, 0, 200, 7, 207) && Covers(region, 200, 200, 207, 207));
+
+  // a merge that reaches another rectangle absorbs it as well
+  region.Add(0, 8, 7, 199);
+  CHECK(region.GetCount() == 3);
+  CHECK(Covers(region, 0, 0, 7, 207));
+
+  // lots of them, everything stays covered
+  srand(1);
+  region.Clear();
+  static PaintRect added[200];
+  for (int i = 0; i < 200; i++) {
+    PaintRect& r = added[i];
+    r.x0 = rand() % 400;
+    r.y0 = rand() % 300;
+    r.x1 = r.x0 + rand() % 20;
+    r.y1 = r.y0 + rand() % 20;
+    region.Add(r.x0, r.y0, r.x1, r.y1);
+    CHECK(region.GetCount() <= PAINT_DIRTY_RECTS);
+    CHECK(Aligned(region));
+    for (int j = 0; j <= i; j++) {
+      if (!Covers(region, added[j].x0, added[j].y0, added[j].x1, added[j].y1)) {
+        CHECK(false);
+        break;
+      }
+    }
+  }
+}
+
+/**
+ *  @brief: a shadowed panel sends nothing for an identical frame and
+ *          only a window for a changed byte
+ */
+static void Shadow(void) {
+  static unsigned char black[400 * 300 / 8], red[400 * 300 / 8];
+  static unsigned char shadowBlack[400 * 300 / 8], shadowRed[400 * 300 / 8];
+  Epd4in2b epd;
+
+  SimPanel.Configure<Epd4in2bTraits>();
+  SimPanel.Timing().refreshUs = 100000;
+  SimPanel.Timing().pollUs = 100;
+  CHECK(epd.Init());
+  epd.SetShadow(shadowBlack, shadowRed);
+  memset(black, 0xFF, sizeof(black));
+  memset(red, 0xFF, sizeof(red));
+  black[1234] = 0x0F;
+
+  CHECK(epd.DisplayFrame(black, red));
+  epd.WaitUntilIdle();
+  uint32_t commands = SimPanel.GetCommandCount();
+  uint32_t bytes = SimPanel.GetDataBytes();
+  uint32_t refreshes = SimPanel.GetRefreshCount() + SimPanel.GetPartialRefreshCount();
+
+  CHECK(!epd.DisplayFrame(black, red));
+  CHECK(SimPanel.GetCommandCount() == commands);
+  CHECK(SimPanel.GetDataBytes() == bytes);
+  CHECK(SimPanel.GetRefreshCount() + SimPanel.GetPartialRefreshCount() == refreshes);
+
+  black[sizeof(black) - 1] = 0x7F;
+  CHECK(epd.DisplayFrame(black, red));
+  epd.WaitUntilIdle();
+  CHECK(SimPanel.GetDataBytes() - bytes < 64);
+  CHECK(SimPanel.GetViolations() == 0);
+  CHECK(SimPanel.GetPixel(399, 299) == EPDSIM_WHITE && SimPanel.GetPixel(392, 299) == EPDSIM_BLACK);
+
+  // a NULL window clears to CLEAR_BLACK, on the panel and in the shadow
+  CHECK(epd.SetPartialWindowBlack(NULL, 392, 296, 8, 4));
+  epd.DisplayFrame();
+  epd.WaitUntilIdle();
+  CHECK(SimPanel.GetPixel(392, 299) == EPDSIM_WHITE);
+  black[sizeof(black) - 1] = 0xFF;
+  CHECK(!epd.DisplayFrame(black, red));
+  CHECK(SimPanel.GetViolations() == 0);
+}
+
+int main(void) {
+  Diff();
+  Region();
+  Shadow();
+  return CHECK_RESULT();
+}
+
+/* END OF FILE */
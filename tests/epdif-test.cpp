@@ -0,0 +1,189 @@
+/**
+ *  @filename   :   epdif-test.cpp
+ *  @brief      :   Asynchronous uploads of EpdIf on the simulated panel:
+ *                  the phases reach the controller in order, one per
+ *                  Poll() once the DMA of the previous one completed,
+ *                  nothing is sent while BUSY is low, and two panels on
+ *                  one bus take turns with the DMA, also when one of
+ *                  them sends synchronously. Refresh predictions only
+ *                  learn from closely polled refreshes.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#define EPD_MULTI_PANEL
+
+#include <SPI.h>
+#include "epd4in2b.h"
+#include "epdsim.h"
+#include "check.h"
+
+#define WIDTH   Epd4in2bTraits::WIDTH
+#define HEIGHT  Epd4in2bTraits::HEIGHT
+#define PLANE   (WIDTH * HEIGHT / 8)
+
+static unsigned char blackA[PLANE], redA[PLANE];
+static unsigned char blackB[PLANE], redB[PLANE];
+
+static void Pattern(unsigned char* black, unsigned char* red, unsigned seed) {
+  for (int i = 0; i < PLANE; i++) {
+    black[i] = (unsigned char)(i * 7 + seed);
+    red[i] = (unsigned char)~((i * 13 + seed) & 0x81);
+  }
+}
+
+static int Mismatches(EpdSim& panel, const unsigned char* black, const unsigned char* red) {
+  int count = 0;
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    for (int16_t x = 0; x < WIDTH; x++) {
+      unsigned char bit = 0x80 >> (x % 8);
+      EPDSIM_COLOR expected = !(red[(y * WIDTH + x) / 8] & bit) ? EPDSIM_RED
+                            : !(black[(y * WIDTH + x) / 8] & bit) ? EPDSIM_BLACK : EPDSIM_WHITE;
+      if (panel.GetPixel(x, y) != expected) count++;
+    }
+  }
+  return count;
+}
+
+/**
+ *  @brief: one panel, every phase waits for the DMA of the one before
+ */
+static void PhaseOrder(void) {
+  Epd4in2b epd;
+  unsigned char log[8];
+
+  CHECK(epd.Init());
+  // the first frame also loads the waveform, synchronously
+  epd.DisplayFrame(blackA, redA);
+  epd.WaitUntilIdle();
+  Pattern(blackA, redA, 1);
+
+  SimPanel.LogCommands(log, sizeof(log));
+  CHECK(epd.DisplayFrameAsync(blackA, redA));
+  CHECK(epd.GetState() == EPD_UPLOADING);
+  CHECK(SimPanel.GetLoggedCommands() == 1 && log[0] == Epd4in2bTraits::DATA_START_TRANSMISSION_1);
+
+  // the black plane is still streaming
+  CHECK(epd.Poll() == EPD_UPLOADING);
+  CHECK(SimPanel.GetLoggedCommands() == 1);
+  CHECK(!epd.DisplayFrameAsync(blackA, redA));
+
+  yield();
+  CHECK(epd.Poll() == EPD_UPLOADING);
+  CHECK(SimPanel.GetLoggedCommands() == 2 && log[1] == Epd4in2bTraits::DATA_START_TRANSMISSION_2);
+
+  yield();
+  CHECK(epd.Poll() == EPD_REFRESHING);
+  CHECK(SimPanel.GetLoggedCommands() == 3 && log[2] == Epd4in2bTraits::DISPLAY_REFRESH);
+
+  // refused while refreshing, the panel sees nothing until BUSY rises
+  CHECK(!epd.DisplayFrameAsync(blackA, redA));
+  CHECK(SimPanel.GetLoggedCommands() == 3);
+  epd.WaitUntilIdle();
+  CHECK(epd.GetState() == EPD_IDLE);
+
+  CHECK(SimPanel.GetRefreshCount() == 2);
+  CHECK(SimPanel.GetViolations() == 0);
+  CHECK(Mismatches(SimPanel, blackA, redA) == 0);
+  SimPanel.LogCommands(NULL, 0);
+}
+
+/**
+ *  @brief: a second panel on its own CS, RST and BUSY, sharing DC, SPI
+ *          and DMA with SimPanel
+ */
+static void SharedDma(void) {
+  EpdSim second;
+  Epd4in2b a;
+  Epd4in2b b(SPI, 11, 9, 12, 13);
+  unsigned char logA[8], logB[8];
+
+  second.Configure<Epd4in2bTraits>();
+  second.SetPins(9, 12, 13, 11);
+  second.Timing() = SimPanel.Timing();
+  CHECK(a.Init());
+  CHECK(b.Init());
+  a.DisplayFrame(blackA, redA);
+  b.DisplayFrame(blackB, redB);
+  a.WaitUntilIdle();
+  b.WaitUntilIdle();
+  Pattern(blackA, redA, 2);
+  Pattern(blackB, redB, 3);
+
+  SimPanel.LogCommands(logA, sizeof(logA));
+  second.LogCommands(logB, sizeof(logB));
+  CHECK(a.DisplayFrameAsync(blackA, redA));
+  CHECK(b.DisplayFrameAsync(blackB, redB));
+  // a holds the DMA, b hasn't sent its first command
+  CHECK(SimPanel.GetLoggedCommands() == 1);
+  CHECK(second.GetLoggedCommands() == 0);
+  CHECK(b.Poll() == EPD_UPLOADING);
+  CHECK(second.GetLoggedCommands() == 0);
+
+  int polls = 0;
+  while ((a.Poll() != EPD_IDLE) | (b.Poll() != EPD_IDLE)) {
+    yield();
+    polls++;
+  }
+  CHECK(polls > 0);
+
+  CHECK(SimPanel.GetLoggedCommands() == 3 && second.GetLoggedCommands() == 3);
+  CHECK(logA[0] == Epd4in2bTraits::DATA_START_TRANSMISSION_1 && logB[0] == Epd4in2bTraits::DATA_START_TRANSMISSION_1);
+  CHECK(logA[1] == Epd4in2bTraits::DATA_START_TRANSMISSION_2 && logB[1] == Epd4in2bTraits::DATA_START_TRANSMISSION_2);
+  CHECK(logA[2] == Epd4in2bTraits::DISPLAY_REFRESH && logB[2] == Epd4in2bTraits::DISPLAY_REFRESH);
+  CHECK(SimPanel.GetViolations() == 0 && second.GetViolations() == 0);
+  CHECK(Mismatches(SimPanel, blackA, redA) == 0);
+  CHECK(Mismatches(second, blackB, redB) == 0);
+
+  // a blocking frame on b waits for the DMA of a before it touches DC or CS
+  Pattern(blackA, redA, 4);
+  Pattern(blackB, redB, 5);
+  CHECK(a.DisplayFrameAsync(blackA, redA));
+  CHECK(a.GetState() == EPD_UPLOADING && !a.isUploadDone());
+  CHECK(b.DisplayFrame(blackB, redB));
+  for (polls = 0; polls < 100000 && a.Poll() != EPD_IDLE; polls++) yield();
+  CHECK(a.GetState() == EPD_IDLE);
+  b.WaitUntilIdle();
+  CHECK(SimPanel.GetViolations() == 0 && second.GetViolations() == 0);
+  CHECK(Mismatches(SimPanel, blackA, redA) == 0);
+  CHECK(Mismatches(second, blackB, redB) == 0);
+  SimPanel.LogCommands(NULL, 0);
+}
+
+/**
+ *  @brief: a refresh polled from a slow loop() doesn't teach the
+ *          prediction its polling period, a tightly polled one does
+ */
+static void Prediction(void) {
+  Epd4in2b epd;
+
+  CHECK(epd.Init());
+  epd.DisplayFrame(blackA, redA);
+  epd.WaitUntilIdle();
+  uint16_t expected = epd.GetExpectedRefreshMs();
+  uint32_t predictions = epd.GetStats().predictions;
+
+  CHECK(epd.DisplayFrame(blackA, redA));
+  while (epd.Poll() != EPD_IDLE) delay(1000);
+  CHECK(epd.GetRefreshDuration() >= 1000);
+  CHECK(epd.GetStats().predictions == predictions);
+  CHECK(epd.GetExpectedRefreshMs() == expected);
+
+  CHECK(epd.DisplayFrame(blackA, redA));
+  epd.WaitUntilIdle();
+  CHECK(epd.GetRefreshDuration() < 110);
+  CHECK(epd.GetStats().predictions == predictions + 1);
+}
+
+int main(void) {
+  SimPanel.Configure<Epd4in2bTraits>();
+  SimPanel.Timing().refreshUs = 100000;
+  SimPanel.Timing().pollUs = 100;
+
+  PhaseOrder();
+  SharedDma();
+  Prediction();
+  return CHECK_RESULT();
+}
+
+/* END OF FILE */
@@ -0,0 +1,326 @@
+/**
+ *  @filename   :   paint-test.cpp
+ *  @brief      :   Golden images of Paint in all four orientations. Every
+ *                  scene is drawn by Paint and by a reference that sets
+ *                  one pixel at a time through the rotation of the
+ *                  baseline, Paint::Rotate<O>():
+ *                    PORTRAIT          (x, y)
+ *                    LANDSCAPE         (width - 1 - y, x)
+ *                    PORTRAIT_FLIPPED  (width - 1 - x, height - 1 - y)
+ *                    LANDSCAPE_FLIPPED (y, height - 1 - x)
+ *                  and the images have to match bit for bit, so a pixel
+ *                  shifted by the span or blit paths fails. Also the
+ *                  UTF-8 decoding of Paint::NextCodePoint().
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <stdlib.h>
+#include "epdpaint.h"
+#include "check.h"
+
+#define MAX_BYTES (176 * 264 / 8)   // largest screen of main()
+
+static const ORIENTATION orientations[] = { PORTRAIT, LANDSCAPE, PORTRAIT_FLIPPED, LANDSCAPE_FLIPPED };
+static const char* names[] = { "PORTRAIT", "LANDSCAPE", "PORTRAIT_FLIPPED", "LANDSCAPE_FLIPPED" };
+
+/**
+ *  Pixel by pixel drawing in logical coordinates, image width is padded
+ *  to whole bytes like in Paint
+ */
+class Reference {
+public:
+  Reference(unsigned char* image, int16_t width, int16_t height, ORIENTATION orientation)
+    : image(image), width((width + 7) & ~7), height(height), orientation(orientation)
+  {}
+
+  void Clear(int16_t colored) {
+    memset(image, colored ? 0xFF : 0x00, width * height / 8);
+  }
+
+  void Absolute(int16_t x, int16_t y, int16_t colored) {
+    if (x < 0 || x >= width || y < 0 || y >= height)
+      return;
+    if (colored)
+      image[(x + y * width) / 8] |= 0x80 >> (x % 8);
+    else
+      image[(x + y * width) / 8] &= ~(0x80 >> (x % 8));
+  }
+
+  void Rotate(int16_t* x, int16_t* y) {
+    int16_t lx = *x;
+    int16_t ly = *y;
+
+    switch (orientation) {
+      case PORTRAIT:          break;
+      case LANDSCAPE:         *x = width - 1 - ly;  *y = lx;                break;
+      case PORTRAIT_FLIPPED:  *x = width - 1 - lx;  *y = height - 1 - ly;   break;
+      case LANDSCAPE_FLIPPED: *x = ly;              *y = height - 1 - lx;   break;
+    }
+  }
+
+  void Pixel(int16_t x, int16_t y, int16_t colored) {
+    Rotate(&x, &y);
+    Absolute(x, y, colored);
+  }
+
+  void Bitmap(int16_t x, int16_t y, const unsigned char* bits, int16_t w, int16_t h, int16_t colored) {
+    int16_t row_bytes = (w + 7) / 8;
+    for (int16_t j = 0; j < h; j++) {
+      for (int16_t i = 0; i < w; i++) {
+        if (bits[j * row_bytes + i / 8] & (0x80 >> (i % 8)))
+          Pixel(x + i, y + j, colored);
+      }
+    }
+  }
+
+  void String(int16_t x, int16_t y, const char* text, const sFONT* font, int16_t colored) {
+    int16_t glyph_bytes = font->Height * ((font->Width + 7) / 8);
+    for (; *text != 0; text++, x += font->Width)
+      Bitmap(x, y, &font->table[(*text - ' ') * glyph_bytes], font->Width, font->Height, colored);
+  }
+
+  void String(int16_t x, int16_t y, const char* text, const pFONT* font, int16_t colored) {
+    for (; *text != 0; text++) {
+      const pGLYPH* glyph = Paint::FindGlyph(font, (uint8_t)*text);
+      if (glyph == NULL)
+        continue;
+      const uint8_t* bits = font->Bitmap + glyph->Offset;
+      for (int16_t j = 0; j < glyph->Height; j++) {
+        for (int16_t i = 0; i < glyph->Width; i++) {
+          uint16_t bit = j * glyph->Width + i;
+          if (bits[bit / 8] & (0x80 >> (bit % 8)))
+            Pixel(x + glyph->XOffset + i, y + glyph->YOffset + j, colored);
+        }
+      }
+      x += glyph->XAdvance;
+    }
+  }
+
+  void FilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
+    for (int16_t y = y0 < y1 ? y0 : y1; y <= (y0 < y1 ? y1 : y0); y++) {
+      for (int16_t x = x0 < x1 ? x0 : x1; x <= (x0 < x1 ? x1 : x0); x++)
+        Pixel(x, y, colored);
+    }
+  }
+
+  void Rectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
+    FilledRectangle(x0, y0, x1, y0, colored);
+    FilledRectangle(x0, y1, x1, y1, colored);
+    FilledRectangle(x0, y0, x0, y1, colored);
+    FilledRectangle(x1, y0, x1, y1, colored);
+  }
+
+  // Bresenham of the baseline, on the rotated end points, end excluded
+  void Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
+    Rotate(&x0, &y0);
+    Rotate(&x1, &y1);
+    int16_t dx = abs(x1 - x0);
+    int16_t sx = x0 < x1 ? 1 : -1;
+    int16_t dy = -abs(y1 - y0);
+    int16_t sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy;
+
+    while (x0 != x1 || y0 != y1) {
+      Absolute(x0, y0, colored);
+      if (2 * err >= dy && x0 != x1) {
+        err += dy;
+        x0 += sx;
+      }
+      if (2 * err <= dx && y0 != y1) {
+        err += dx;
+        y0 += sy;
+      }
+    }
+  }
+
+  void Circle(int16_t x, int16_t y, int16_t radius, int16_t colored, bool filled) {
+    int16_t x_pos = -radius;
+    int16_t y_pos = 0;
+    int16_t err = 2 - 2 * radius;
+    int16_t e2;
+
+    do {
+      Pixel(x - x_pos, y + y_pos, colored);
+      Pixel(x + x_pos, y + y_pos, colored);
+      Pixel(x + x_pos, y - y_pos, colored);
+      Pixel(x - x_pos, y - y_pos, colored);
+      if (filled) {
+        FilledRectangle(x + x_pos, y + y_pos, x - x_pos, y + y_pos, colored);
+        FilledRectangle(x + x_pos, y - y_pos, x - x_pos, y - y_pos, colored);
+      }
+      e2 = err;
+      if (e2 <= y_pos) {
+        err += ++y_pos * 2 + 1;
+        if (-x_pos == y_pos && e2 <= x_pos)
+          e2 = 0;
+      }
+      if (e2 > x_pos)
+        err += ++x_pos * 2 + 1;
+    } while (x_pos <= 0);
+  }
+
+  unsigned char* image;
+  int16_t        width;
+  int16_t        height;
+  ORIENTATION    orientation;
+};
+
+static const unsigned char arrow[] = {     // 11 x 6, rows padded to 2 bytes
+  0x04, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0xE0,
+};
+
+static unsigned char image[MAX_BYTES];
+static unsigned char golden[MAX_BYTES];
+static uint8_t       columns[8192];
+
+/**
+ *  @brief: the same scene on both, shapes cross every edge of the
+ *          logical screen so clipping is covered as well
+ */
+static void Scene(Paint& paint, Reference& ref, const sFONT* font, const sFONT* rotated) {
+  int16_t w = paint.GetWidth();
+  int16_t h = paint.GetHeight();
+
+  paint.Clear(0);
+  ref.Clear(0);
+
+  paint.DrawPixel(0, 0, 1);                     ref.Pixel(0, 0, 1);
+  paint.DrawPixel(w - 1, 0, 1);                 ref.Pixel(w - 1, 0, 1);
+  paint.DrawPixel(0, h - 1, 1);                 ref.Pixel(0, h - 1, 1);
+  paint.DrawPixel(w - 1, h - 1, 1);             ref.Pixel(w - 1, h - 1, 1);
+  paint.DrawPixel(w, h, 1);                     ref.Pixel(w, h, 1);
+
+  paint.DrawHorizontalLine(-3, 2, w + 6, 1);    ref.FilledRectangle(-3, 2, w + 2, 2, 1);
+  paint.DrawVerticalLine(3, -5, h + 10, 1);     ref.FilledRectangle(3, -5, 3, h + 4, 1);
+  paint.DrawRectangle(5, 7, w - 6, 20, 1);      ref.Rectangle(5, 7, w - 6, 20, 1);
+  paint.DrawFilledRectangle(w - 13, h - 9, w + 4, h + 2, 1);
+  ref.FilledRectangle(w - 13, h - 9, w + 4, h + 2, 1);
+  paint.DrawFilledRectangle(9, 10, 30, 13, 0);  ref.FilledRectangle(9, 10, 30, 13, 0);
+
+  paint.DrawLine(1, 25, w - 2, 60, 1);          ref.Line(1, 25, w - 2, 60, 1);
+  paint.DrawLine(w - 5, 30, 4, 33, 1);          ref.Line(w - 5, 30, 4, 33, 1);
+  paint.DrawCircle(20, 80, 11, 1);              ref.Circle(20, 80, 11, 1, false);
+  paint.DrawFilledCircle(w - 4, 90, 9, 1);      ref.Circle(w - 4, 90, 9, 1, true);
+
+  paint.DrawBitmapAt(-4, 100, arrow, 11, 6, 1); ref.Bitmap(-4, 100, arrow, 11, 6, 1);
+  paint.DrawBitmapAt(w - 7, 108, arrow, 11, 6, 1);
+  ref.Bitmap(w - 7, 108, arrow, 11, 6, 1);
+
+  paint.DrawStringAt(-2, 116, "Hg@{|}", font, 1);
+  ref.String(-2, 116, "Hg@{|}", font, 1);
+  paint.DrawStringAt(w - 3 * font->Width + 1, h - font->Height + 2, "q#W", font, 1);
+  ref.String(w - 3 * font->Width + 1, h - font->Height + 2, "q#W", font, 1);
+  paint.DrawStringAt(1, 140, "Aj", rotated, 1);
+  ref.String(1, 140, "Aj", rotated, 1);
+  paint.DrawStringAt(7, 160, "jQ(y)", &PFont16, 1);
+  ref.String(7, 160, "jQ(y)", &PFont16, 1);
+  paint.DrawStringAt(-3, h - 10, "fT", &PFont24, 1);
+  ref.String(-3, h - 10, "fT", &PFont24, 1);
+  paint.DrawFilledRectangle(10, 165, 14, 170, 0);
+  ref.FilledRectangle(10, 165, 14, 170, 0);
+}
+
+/**
+ *  @brief: Paint against the reference for a screen and font in all
+ *          orientations
+ */
+static void Golden(int16_t width, int16_t height, const sFONT* font) {
+  sFONT rotated = *font;
+  int32_t size = Paint::GetRotatedFontSize(&rotated);
+
+  CHECK(size <= (int32_t)sizeof(columns));
+  CHECK(Paint::RotateFont(&rotated, columns, sizeof(columns)));
+
+  for (int o = 0; o < 4; o++) {
+    Paint paint(image, width, height, orientations[o]);
+    Reference ref(golden, width, height, orientations[o]);
+    int bytes = ref.width * height / 8;
+
+    Scene(paint, ref, font, &rotated);
+    int diff = 0;
+    while (diff < bytes && image[diff] == golden[diff]) diff++;
+    if (diff < bytes) {
+      fprintf(stderr, "%dx%d %s Font%d: byte %d (x %d, y %d) is %02X, expected %02X\n",
+              width, height, names[o], font->Height, diff, diff % (ref.width / 8) * 8,
+              diff / (ref.width / 8), image[diff], golden[diff]);
+    }
+    CHECK(diff == bytes);
+  }
+}
+
+/**
+ *  @brief: where the logical corners land, spelled out, in case the
+ *          reference and Paint shared a mistake
+ */
+static void Corners(void) {
+  static const struct { ORIENTATION o; int16_t x, y; } origin[] = {
+    { PORTRAIT, 0, 0 }, { LANDSCAPE, 127, 0 }, { PORTRAIT_FLIPPED, 127, 295 }, { LANDSCAPE_FLIPPED, 0, 295 },
+  };
+
+  for (int o = 0; o < 4; o++) {
+    Paint paint(image, 128, 296, origin[o].o);
+    paint.Clear(0);
+    paint.DrawPixel(0, 0, 1);
+    paint.DrawPixel(1, 0, 1);
+    int16_t x = origin[o].x;
+    int16_t y = origin[o].y;
+    CHECK(image[(x + y * 128) / 8] & (0x80 >> (x % 8)));
+    // the next logical pixel along x
+    if (origin[o].o == PORTRAIT)          x += 1;
+    if (origin[o].o == LANDSCAPE)         y += 1;
+    if (origin[o].o == PORTRAIT_FLIPPED)  x -= 1;
+    if (origin[o].o == LANDSCAPE_FLIPPED) y -= 1;
+    CHECK(image[(x + y * 128) / 8] & (0x80 >> (x % 8)));
+    int set = 0;
+    for (int i = 0; i < 128 * 296 / 8; i++) set += __builtin_popcount(image[i]);
+    CHECK(set == 2);
+  }
+}
+
+/**
+ *  @brief: what Paint::NextCodePoint() makes of valid, overlong, surrogate,
+ *          4 byte and truncated sequences, and how far it moves on
+ */
+static void Utf8(void) {
+  static const struct { const char* text; uint16_t code; int length; } cases[] = {
+    { "A",                  0x0041, 1 },
+    { "\xC3\xA9",           0x00E9, 2 },
+    { "\xE2\x82\xAC",       0x20AC, 3 },
+    { "\xEF\xBF\xBD",       0xFFFD, 3 },
+    { "\xC0\x80",           0xFFFD, 1 },   // overlong, C0 and C1 never lead
+    { "\xC1\xBF",           0xFFFD, 1 },
+    { "\xE0\x80\x80",       0xFFFD, 3 },   // overlong 3 byte
+    { "\xE0\x9F\xBF",       0xFFFD, 3 },
+    { "\xED\xA0\x80",       0xFFFD, 3 },   // surrogate
+    { "\xF0\x80\xA0\x80",   0xFFFD, 4 },   // overlong U+0800
+    { "\xF0\x80\x80\x80",   0xFFFD, 4 },   // overlong U+0000
+    { "\xF0\x8F\xBF\xBF",   0xFFFD, 4 },   // overlong U+FFFF
+    { "\xF0\x9F\x98\x80",   0xFFFD, 4 },   // U+1F600, beyond 0xFFFF
+    { "\xF4\x90\x80\x80",   0xFFFD, 4 },   // beyond U+10FFFF
+    { "\xF5\x80\x80\x80",   0xFFFD, 1 },
+    { "\xE2\x82" "A",        0xFFFD, 2 },   // truncated, the A stays
+    { "\x80",               0xFFFD, 1 },
+  };
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    const char* text = cases[i].text;
+    uint16_t code = Paint::NextCodePoint(&text);
+    if (code != cases[i].code || text - cases[i].text != cases[i].length)
+      fprintf(stderr, "UTF-8 case %d: U+%04X after %d bytes\n", (int)i, code, (int)(text - cases[i].text));
+    CHECK(code == cases[i].code && text - cases[i].text == cases[i].length);
+  }
+}
+
+int main(void) {
+  Corners();
+  Utf8();
+  Golden(128, 296, &Font16);   // 2.9"
+  Golden(104, 212, &Font12);   // 2.13"
+  Golden(122, 250, &Font20);   // width padded to whole bytes
+  Golden(200, 200, &Font24);   // 1.54"
+  Golden(176, 264, &Font8);    // 2.7"
+  return CHECK_RESULT();
+}
+
+/* END OF FILE */
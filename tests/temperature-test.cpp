@@ -0,0 +1,53 @@
+/**
+ *  @filename   :   temperature-test.cpp
+ *  @brief      :   ReadTemperature() takes the sensor of the simulated
+ *                  2.7" controller, and keeps the band when MISO isn't
+ *                  driven, is pulled either way or reads out of range.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <SPI.h>
+#include "epd2in7b.h"
+#include "epdsim.h"
+#include "check.h"
+
+int main(void) {
+  Epd2in7b epd;
+
+  SimPanel.Configure<Epd2in7bTraits>();
+  SimPanel.Timing().refreshUs = 1000;
+  CHECK(epd.Init());
+
+  SimPanel.SetTemperature(24.5);
+  CHECK(epd.ReadTemperature());
+  CHECK(epd.GetTemperature() == 24 && epd.GetTemperatureBand() == 2);
+
+  // DIN not wired, MISO pulled down or up
+  SimPanel.SetDinUnwired(true, 0x00);
+  CHECK(!epd.ReadTemperature());
+  CHECK(epd.GetTemperature() == 24 && epd.GetTemperatureBand() == 2);
+  SimPanel.SetDinUnwired(true, 0xFF);
+  CHECK(!epd.ReadTemperature());
+  CHECK(epd.GetTemperature() == 24 && epd.GetTemperatureBand() == 2);
+  SimPanel.SetDinUnwired(false);
+
+  // outside what the sensor is specified for
+  SimPanel.SetTemperature(-50);
+  CHECK(!epd.ReadTemperature());
+  SimPanel.SetTemperature(100);
+  CHECK(!epd.ReadTemperature());
+  CHECK(epd.GetTemperature() == 24 && epd.GetTemperatureBand() == 2);
+
+  SimPanel.SetTemperature(-12.25);
+  CHECK(epd.ReadTemperature());
+  CHECK(epd.GetTemperature() == -13 && epd.GetTemperatureBand() == 0);
+  SimPanel.SetTemperature(31);
+  CHECK(epd.ReadTemperature());
+  CHECK(epd.GetTemperature() == 31 && epd.GetTemperatureBand() == 3);
+
+  CHECK(SimPanel.GetViolations() == 0);
+  return CHECK_RESULT();
+}
+
+/* END OF FILE */
@@ -0,0 +1,80 @@
+/**
+ *  @filename   :   textbox-test.cpp
+ *  @brief      :   The rectangle of TextBox::Draw() holds every pixel it
+ *                  set, with glyphs reaching left of the pen, past their
+ *                  advance and above the line, in all orientations and
+ *                  alignments and with the ellipsis.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include "epdtextbox.h"
+#include "check.h"
+
+// solid boxes, so every pixel of a glyph box is set
+static const uint8_t bitmap[16] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const pGLYPH glyphs[] = {
+  // Offset, Width, Height, XOffset, YOffset, XAdvance
+  { 0, 0,  0,  0,  0, 3 },     // ' '
+  { 0, 1,  1,  0,  7, 2 },     // '.'
+  { 0, 6,  8, -3,  1, 4 },     // 'A' starts left of the pen
+  { 0, 9, 12,  1, -2, 5 },     // 'B' ends past its advance, above the line
+};
+
+static const pRANGE ranges[] = {
+  { ' ', ' ', 0 },
+  { '.', '.', 1 },
+  { 'A', 'B', 2 },
+};
+
+static const pFONT overhang = { bitmap, glyphs, ranges, 3, 0, 10, 8 };
+
+static unsigned char image[64 * 96 / 8];
+
+static void Check(ORIENTATION orientation, TEXT_ALIGN align, bool wrap, const char* text) {
+  Paint paint(image, 64, 96, orientation);
+  TextBox box(&overhang, 40, 30, align, wrap);
+  PaintRect r;
+
+  paint.Clear(0);
+  CHECK(box.Draw(paint, 12, 20, text, 1, &r));
+  CHECK((r.x0 & 7) == 0 && (r.x1 & 7) == 7);
+
+  int outside = 0;
+  for (int16_t y = 0; y < 96; y++) {
+    for (int16_t x = 0; x < 64; x++) {
+      bool set = image[(x + y * 64) / 8] & (0x80 >> (x % 8));
+      if (set && (x < r.x0 || x > r.x1 || y < r.y0 || y > r.y1)) outside++;
+    }
+  }
+  if (outside > 0)
+    fprintf(stderr, "orientation %d align %d \"%s\": %d pixels outside\n", orientation, align, text, outside);
+  CHECK(outside == 0);
+
+  // which makes the rectangle enough to erase the text
+  paint.FillAbsoluteRect(r.x0, r.y0, r.x1, r.y1, 0);
+  int left = 0;
+  for (size_t i = 0; i < sizeof(image); i++) left += image[i] != 0;
+  CHECK(left == 0);
+}
+
+int main(void) {
+  static const ORIENTATION orientations[] = { PORTRAIT, LANDSCAPE, PORTRAIT_FLIPPED, LANDSCAPE_FLIPPED };
+  static const TEXT_ALIGN aligns[] = { ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT };
+  static const char* texts[] = { "A", "B", "AB BA", "BBBBBBBBBBBBBBBBBBBB", "A A A A A A A A A A A A A A A A A" };
+
+  for (int o = 0; o < 4; o++) {
+    for (int a = 0; a < 3; a++) {
+      for (size_t t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+        Check(orientations[o], aligns[a], true, texts[t]);
+        Check(orientations[o], aligns[a], false, texts[t]);
+      }
+    }
+  }
+  return CHECK_RESULT();
+}
+
+/* END OF FILE */
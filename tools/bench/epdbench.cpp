@@ -0,0 +1,496 @@
+/**
+ *  @filename   :   epdbench.cpp
+ *  @brief      :   Host benchmark of the Paint primitives at every panel
+ *                  resolution and orientation, and of each driver's
+ *                  DisplayFrame() conversion and upload loop on the
+ *                  simulated panel. Prints CSV:
+ *                    panel,orientation,op,iterations,ns_per_op,pixels_per_s
+ *  pixels_per_s is only given for the fills, the DrawPixel_ rows draw the
+ *  same pixels one DrawPixel() at a time for comparison.
+ *  With --wake it instead prints the simulated panel time from Init() to
+ *  the first refresh, cold and after Sleep():
+ *                    panel,op,panel_us
+ *  With --bands it times DisplayFrame() from display lists of one page in
+ *  bands of 8, 32 and 128 rows, the band buffer and the two lists are all
+ *  the RAM it takes, ns_per_band covers both planes:
+ *                    panel,band_rows,bands,band_bytes,list_bytes,ns_per_frame,ns_per_band
+ *  With --fonts it lists the font tables and what they take:
+ *                    font,width,height,table_bytes,rotated_bytes
+ *  With --io it counts what Init() and DisplayFrame() cost on the bus,
+ *  the GPIO writes to CS, DC and RST, the reads of BUSY and the SPI
+ *  messages and bytes:
+ *                    panel,op,pin_writes,busy_reads,spi_messages,spi_bytes
+ *
+ *  Usage
+ *    epdbench [--min-ms N] [--wake | --io | --bands | --fonts] [filter]
+ *  Only rows whose panel or op contain filter are run, each row is the
+ *  best of 5 batches of at least N ms (default 20).
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#define EPD_MULTI_PANEL
+
+#include <stdio.h>
+#include <chrono>
+#include "epd1in54b.h"
+#include "epd2in13b.h"
+#include "epd2in7b.h"
+#include "epd2in9b.h"
+#include "epd4in2b.h"
+#include "epd7in5b.h"
+#include "epdsim.h"
+#include "epdtextbox.h"
+
+#define BENCH_BATCHES   5
+
+static uint32_t    minNs = 20000000;
+static const char* filter = NULL;
+
+static unsigned char black[640 * 384 / 8];
+static unsigned char red[640 * 384 / 8];
+static uint8_t columns[FONT_GLYPHS * 17 * 3];   // Font24 rotated, the largest
+static unsigned char band[2 * 640 / 8 * 128];   // 128 rows of the 7.5", black and red
+static unsigned char listBlack[4096];
+static unsigned char listRed[1024];
+
+static const ORIENTATION orientations[] = { PORTRAIT, LANDSCAPE, PORTRAIT_FLIPPED, LANDSCAPE_FLIPPED };
+static const char* orientationNames[] = { "portrait", "landscape", "portrait_flipped", "landscape_flipped" };
+
+static uint64_t Now(void) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool Selected(const char* panel, const char* op) {
+  return filter == NULL || strstr(panel, filter) != NULL || strstr(op, filter) != NULL;
+}
+
+/**
+ *  @brief: runs op in batches grown until one takes minNs, returns the
+ *          best time of a batch of iterations calls
+ */
+template <class Op>
+static uint64_t Measure(Op fn, uint32_t& iterations) {
+  uint64_t elapsed;
+
+  iterations = 1;
+  for (;;) {
+    uint64_t start = Now();
+    for (uint32_t i = 0; i < iterations; i++) fn();
+    elapsed = Now() - start;
+    if (elapsed >= minNs || iterations >= 0x40000000) break;
+    iterations *= elapsed < minNs / 16 ? 8 : 2;
+  }
+  for (int b = 1; b < BENCH_BATCHES; b++) {
+    uint64_t start = Now();
+    for (uint32_t i = 0; i < iterations; i++) fn();
+    uint64_t t = Now() - start;
+    if (t < elapsed) elapsed = t;
+  }
+  return elapsed;
+}
+
+/**
+ *  @brief: prints the best time per call of op, and the fill rate of an op
+ *          that sets pixels
+ */
+template <class Op>
+static void Bench(const char* panel, const char* orientation, const char* op, Op fn, uint32_t pixels = 0) {
+  if (!Selected(panel, op)) return;
+
+  uint32_t iterations;
+  uint64_t elapsed = Measure(fn, iterations);
+  double ns = (double)elapsed / iterations;
+  if (pixels > 0) printf("%s,%s,%s,%u,%.1f,%.0f\n", panel, orientation, op, (unsigned)iterations, ns, pixels * 1e9 / ns);
+  else printf("%s,%s,%s,%u,%.1f,\n", panel, orientation, op, (unsigned)iterations, ns);
+  fflush(stdout);
+}
+
+/**
+ *  @brief: the fills as they were before the span fills, one DrawPixel()
+ *          at a time, each returns the pixels drawn
+ */
+static uint32_t PixelRectangle(Paint& paint, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t colored) {
+  for (int16_t x = x0; x <= x1; x++) {
+    for (int16_t y = y0; y <= y1; y++) paint.DrawPixel(x, y, colored);
+  }
+  return (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+static uint32_t PixelCircle(Paint& paint, int16_t x, int16_t y, int16_t radius, int16_t colored) {
+  int16_t x_pos = -radius;
+  int16_t y_pos = 0;
+  int16_t err = 2 - 2 * radius;
+  int16_t e2;
+  uint32_t pixels = 0;
+
+  do {
+    for (int16_t i = x_pos; i <= -x_pos; i++) {
+      paint.DrawPixel(x + i, y + y_pos, colored);
+      paint.DrawPixel(x + i, y - y_pos, colored);
+    }
+    pixels += 2 * (2 * (-x_pos) + 1);
+    e2 = err;
+    if (e2 <= y_pos) {
+      err += ++y_pos * 2 + 1;
+      if (-x_pos == y_pos && e2 <= x_pos) {
+        e2 = 0;
+      }
+    }
+    if (e2 > x_pos) {
+      err += ++x_pos * 2 + 1;
+    }
+  } while (x_pos <= 0);
+  return pixels;
+}
+
+static void BenchPaint(const char* panel, int width, int height) {
+  static const struct { const char* name; const char* page; const char* rotated; sFONT* font; } fonts[] = {
+    { "DrawStringAt_Font8", "TextPage_Font8", "TextPage_Font8_rotated", &Font8 },
+    { "DrawStringAt_Font12", "TextPage_Font12", "TextPage_Font12_rotated", &Font12 },
+    { "DrawStringAt_Font16", "TextPage_Font16", "TextPage_Font16_rotated", &Font16 },
+    { "DrawStringAt_Font20", "TextPage_Font20", "TextPage_Font20_rotated", &Font20 },
+    { "DrawStringAt_Font24", "TextPage_Font24", "TextPage_Font24_rotated", &Font24 },
+  };
+  static const struct { const char* name; const char* page; pFONT* font; } pfonts[] = {
+    { "DrawStringAt_PFont8", "TextPage_PFont8", &PFont8 },
+    { "DrawStringAt_PFont12", "TextPage_PFont12", &PFont12 },
+    { "DrawStringAt_PFont16", "TextPage_PFont16", &PFont16 },
+    { "DrawStringAt_PFont20", "TextPage_PFont20", &PFont20 },
+    { "DrawStringAt_PFont24", "TextPage_PFont24", &PFont24 },
+  };
+  // lines longer than the widest canvas, the tail runs off the edge
+  static const char* line = "The quick brown fox jumps over the lazy dog 0123456789 !?#%&*+-/<=>@[]{}~";
+  static const char* paragraph = "Sensor 3 reported 21.5 degrees at 08:15, the battery is at 87 percent and "
+                                 "the next update is due in 15 minutes. Tap the button to refresh now.";
+
+  for (int o = 0; o < 4; o++) {
+    Paint paint(black, width, height, orientations[o]);
+    const char* on = orientationNames[o];
+    int16_t w = paint.GetWidth();
+    int16_t h = paint.GetHeight();
+    int16_t r = (w < h ? w : h) / 3;
+
+    uint32_t screen = (uint32_t)w * h;
+    Bench(panel, on, "Clear", [&]() { paint.Clear(1); }, screen);
+    Bench(panel, on, "DrawPixel_Clear", [&]() { PixelRectangle(paint, 0, 0, w - 1, h - 1, 1); }, screen);
+    for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+      sFONT* font = fonts[f].font;
+      Bench(panel, on, fonts[f].name, [&]() { paint.DrawStringAt(0, h / 2, "Hello e-Paper!", font, 0); });
+      Bench(panel, on, fonts[f].page, [&]() {
+        for (int16_t y = 0; y < h; y += font->Height) paint.DrawStringAt(0, y, line, font, 0);
+      });
+      if (orientations[o] != LANDSCAPE && orientations[o] != LANDSCAPE_FLIPPED) continue;
+      Paint::RotateFont(font, columns, sizeof(columns));
+      Bench(panel, on, fonts[f].rotated, [&]() {
+        for (int16_t y = 0; y < h; y += font->Height) paint.DrawStringAt(0, y, line, font, 0);
+      });
+      Paint::RotateFont(font, NULL, 0);
+    }
+    for (size_t f = 0; f < sizeof(pfonts) / sizeof(pfonts[0]); f++) {
+      pFONT* font = pfonts[f].font;
+      Bench(panel, on, pfonts[f].name, [&]() { paint.DrawStringAt(0, h / 2, "Hello e-Paper!", font, 0); });
+      Bench(panel, on, pfonts[f].page, [&]() {
+        for (int16_t y = 0; y < h; y += font->Height) paint.DrawStringAt(0, y, line, font, 0);
+      });
+    }
+    TextBox box(&PFont16, w, h, ALIGN_CENTER);
+    Bench(panel, on, "TextBox_Layout", [&]() { box.ClearCache(); box.Layout(paragraph); });
+    Bench(panel, on, "TextBox_Draw", [&]() { box.Draw(paint, 0, 0, paragraph, 0); });
+    Bench(panel, on, "DrawLine", [&]() { paint.DrawLine(0, 0, w - 1, h - 1, 0); });
+    Bench(panel, on, "DrawCircle", [&]() { paint.DrawCircle(w / 2, h / 2, r, 0); });
+    uint32_t disc = PixelCircle(paint, w / 2, h / 2, r, 0);
+    Bench(panel, on, "DrawFilledCircle", [&]() { paint.DrawFilledCircle(w / 2, h / 2, r, 0); }, disc);
+    Bench(panel, on, "DrawPixel_FilledCircle", [&]() { PixelCircle(paint, w / 2, h / 2, r, 0); }, disc);
+    uint32_t area = PixelRectangle(paint, w / 4, h / 4, 3 * w / 4, 3 * h / 4, 0);
+    Bench(panel, on, "DrawFilledRectangle", [&]() { paint.DrawFilledRectangle(w / 4, h / 4, 3 * w / 4, 3 * h / 4, 0); }, area);
+    Bench(panel, on, "DrawPixel_FilledRectangle", [&]() { PixelRectangle(paint, w / 4, h / 4, 3 * w / 4, 3 * h / 4, 0); }, area);
+  }
+}
+
+/**
+ *  @brief: times DisplayFrame() up to the refresh command, the refresh
+ *          itself is simulated and waited for outside the timing
+ */
+template <class E, class Traits>
+static void BenchPanel(const char* panel) {
+  BenchPaint(panel, Traits::WIDTH, Traits::HEIGHT);
+  if (!Selected(panel, "DisplayFrame")) return;
+
+  E epd;
+  SimPanel.Configure<Traits>();
+  SimPanel.SetDecoding(false);
+  SimPanel.Timing().refreshUs = 0;
+  SimPanel.Timing().pollUs = EPDIF_BUSY_LATENCY_MS * 1000;
+  epd.Init();
+  Bench(panel, "-", "DisplayFrame", [&]() { epd.DisplayFrame(black, red); epd.WaitUntilIdle(); });
+  SimPanel.SetDecoding(true);
+}
+
+/**
+ *  @brief: simulated time of Init() alone and up to the running refresh of
+ *          the first frame, once cold and once woken from Sleep()
+ */
+template <class E, class Traits>
+static void BenchWake(const char* panel) {
+  E epd;
+  uint64_t start;
+
+  SimPanel.Configure<Traits>();
+  SimPanel.SetDecoding(false);
+  SimPanel.Timing().messageUs = 10;
+
+  start = SimPanel.GetTimeNs();
+  epd.Init();
+  printf("%s,Init,%.1f\n", panel, (SimPanel.GetTimeNs() - start) / 1000.0);
+  epd.DisplayFrame(black, red);
+  printf("%s,InitToRefresh,%.1f\n", panel, (SimPanel.GetTimeNs() - start) / 1000.0);
+  epd.Sleep();
+  epd.WaitUntilIdle();
+
+  start = SimPanel.GetTimeNs();
+  epd.Init();
+  printf("%s,Wake,%.1f\n", panel, (SimPanel.GetTimeNs() - start) / 1000.0);
+  epd.DisplayFrame(black, red);
+  printf("%s,WakeToRefresh,%.1f\n", panel, (SimPanel.GetTimeNs() - start) / 1000.0);
+  epd.WaitUntilIdle();
+
+  SimPanel.Timing().messageUs = 0;
+  SimPanel.SetDecoding(true);
+}
+
+struct IoCounts {
+  uint32_t pinWrites;
+  uint32_t busyReads;
+  uint32_t messages;
+  uint32_t bytes;
+};
+
+static IoCounts CountIo(void) {
+  IoCounts counts = { SimPanel.GetPinWrites(), SimPanel.GetBusyReads(), SPI.GetMessages(), SPI.GetBytes() };
+  return counts;
+}
+
+static void PrintIo(const char* panel, const char* op, const IoCounts& start) {
+  IoCounts now = CountIo();
+  printf("%s,%s,%u,%u,%u,%u\n", panel, op, (unsigned)(now.pinWrites - start.pinWrites), (unsigned)(now.busyReads - start.busyReads),
+         (unsigned)(now.messages - start.messages), (unsigned)(now.bytes - start.bytes));
+}
+
+/**
+ *  @brief: GPIO and SPI traffic of Init(), of the first frame, which also
+ *          loads the waveform, and of a frame after it. The refresh is
+ *          waited for outside the counts.
+ */
+template <class E, class Traits>
+static void CountPanel(const char* panel) {
+  E epd;
+  IoCounts start;
+
+  SimPanel.Configure<Traits>();
+  SimPanel.SetDecoding(false);
+  SimPanel.Timing().refreshUs = 0;
+  SimPanel.Timing().pollUs = EPDIF_BUSY_LATENCY_MS * 1000;
+
+  start = CountIo();
+  epd.Init();
+  // SPI.begin() in Init() restarts the SPI counts
+  start.messages = start.bytes = 0;
+  PrintIo(panel, "Init", start);
+  start = CountIo();
+  epd.DisplayFrame(black, red);
+  PrintIo(panel, "FirstFrame", start);
+  epd.WaitUntilIdle();
+  start = CountIo();
+  epd.DisplayFrame(black, red);
+  PrintIo(panel, "DisplayFrame", start);
+  epd.WaitUntilIdle();
+
+  SimPanel.SetDecoding(true);
+}
+
+/**
+ *  @brief: the same for DisplayFrameAsync() driven by Poll() until the
+ *          refresh runs, only on panels taking 1bpp planes as they are
+ */
+template <class E, class Traits>
+static void CountPanelAsync(const char* panel) {
+  E epd;
+  IoCounts start;
+
+  SimPanel.Configure<Traits>();
+  SimPanel.SetDecoding(false);
+  SimPanel.Timing().refreshUs = 0;
+  SimPanel.Timing().pollUs = EPDIF_BUSY_LATENCY_MS * 1000;
+  epd.Init();
+  epd.DisplayFrame(black, red);
+  epd.WaitUntilIdle();
+
+  start = CountIo();
+  epd.DisplayFrameAsync(black, red);
+  while (epd.Poll() == EPD_UPLOADING) yield();
+  PrintIo(panel, "DisplayFrameAsync", start);
+  epd.WaitUntilIdle();
+
+  SimPanel.SetDecoding(true);
+}
+
+/**
+ *  @brief: DisplayFrame() of a page recorded in display lists, in bands
+ *          of a few sizes. The 7.5" holds the black and the red rows of a
+ *          band together, so its bands take twice the bytes.
+ */
+template <class E, class Traits>
+static void BenchBands(const char* panel) {
+  static const int16_t sizes[] = { 8, 32, 128 };
+  static const char* text = "Sensor 3 reported 21.5 degrees at 08:15, the battery is at 87 percent";
+  const int32_t perRow = (Traits::PIXEL_FORMAT == EPD_4BPP ? 2 : 1) * Traits::WIDTH / 8;
+  DisplayList displayBlack(listBlack, sizeof(listBlack));
+  DisplayList displayRed(listRed, sizeof(listRed));
+  Paint paint(black, Traits::WIDTH, Traits::HEIGHT);
+  int16_t w = paint.GetWidth();
+  int16_t h = paint.GetHeight();
+  E epd;
+
+  if (!Selected(panel, "DisplayFrame_bands")) return;
+
+  for (int16_t y = 24; y + 16 < h; y += 16) displayBlack.DrawStringAt(2, y, text, &PFont16, 0);
+  displayBlack.DrawRectangle(0, 0, w - 1, h - 1, 0);
+  displayBlack.DrawLine(0, h - 1, w - 1, 0, 0);
+  displayBlack.DrawCircle(w / 2, h / 2, w / 4, 0);
+  displayRed.DrawFilledRectangle(0, 0, w - 1, 21, 0);
+  displayRed.DrawStringAt(4, 2, "Weather", &Font20, 1);
+  displayRed.DrawFilledCircle(w - 20, h - 20, 12, 0);
+
+  SimPanel.Configure<Traits>();
+  SimPanel.SetDecoding(false);
+  SimPanel.Timing().refreshUs = 0;
+  SimPanel.Timing().pollUs = EPDIF_BUSY_LATENCY_MS * 1000;
+  epd.Init();
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    int16_t rows = sizes[i] < Traits::HEIGHT ? sizes[i] : (int16_t)Traits::HEIGHT;
+    int32_t bytes = rows * perRow;
+    int16_t bands = (Traits::HEIGHT + rows - 1) / rows;
+    uint32_t iterations;
+    uint64_t elapsed = Measure([&]() {
+      epd.DisplayFrame(displayBlack, displayRed, band, bytes);
+      epd.WaitUntilIdle();
+    }, iterations);
+    double frame = (double)elapsed / iterations;
+    printf("%s,%d,%d,%d,%d,%.1f,%.1f\n", panel, rows, bands, (int)bytes,
+           displayBlack.GetUsed() + displayRed.GetUsed(), frame, frame / bands);
+    fflush(stdout);
+  }
+  SimPanel.SetDecoding(true);
+}
+
+/**
+ *  @brief: flash of each font table and RAM of its rotated copy, the
+ *          proportional fonts take their bitmap, glyph and range tables in flash,
+ *          width is the widest advance
+ */
+static void ListFonts(void) {
+  static const struct { const char* name; sFONT* font; } fonts[] = {
+    { "Font8", &Font8 }, { "Font12", &Font12 }, { "Font16", &Font16 }, { "Font20", &Font20 }, { "Font24", &Font24 },
+  };
+  static const struct { const char* name; pFONT* font; } pfonts[] = {
+    { "PFont8", &PFont8 }, { "PFont12", &PFont12 }, { "PFont16", &PFont16 }, { "PFont20", &PFont20 }, { "PFont24", &PFont24 },
+  };
+
+  printf("font,width,height,table_bytes,rotated_bytes\n");
+  for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+    const sFONT* font = fonts[f].font;
+    printf("%s,%u,%u,%d,%d\n", fonts[f].name, font->Width, font->Height,
+           FONT_GLYPHS * font->Height * ((font->Width + 7) / 8), (int)Paint::GetRotatedFontSize(font));
+  }
+  for (size_t f = 0; f < sizeof(pfonts) / sizeof(pfonts[0]); f++) {
+    const pFONT* font = pfonts[f].font;
+    const pRANGE& range = font->Ranges[font->RangeCount - 1];
+    int glyphs = range.Glyph + range.Last - range.First + 1;
+    const pGLYPH& last = font->Glyphs[glyphs - 1];
+    int width = 0;
+    for (int g = 0; g < glyphs; g++) {
+      if (font->Glyphs[g].XAdvance > width) width = font->Glyphs[g].XAdvance;
+    }
+    printf("%s,%d,%u,%d,0\n", pfonts[f].name, width, font->Height,
+           last.Offset + (last.Width * last.Height + 7) / 8 + glyphs * (int)sizeof(pGLYPH) + font->RangeCount * (int)sizeof(pRANGE));
+  }
+}
+
+int main(int argc, char** argv) {
+  bool wake = false;
+  bool io = false;
+  bool bands = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--min-ms") && i + 1 < argc) minNs = atoi(argv[++i]) * 1000000;
+    else if (!strcmp(argv[i], "--wake")) wake = true;
+    else if (!strcmp(argv[i], "--io")) io = true;
+    else if (!strcmp(argv[i], "--bands")) bands = true;
+    else if (!strcmp(argv[i], "--fonts")) {
+      ListFonts();
+      return 0;
+    }
+    else filter = argv[i];
+  }
+  memset(black, 0xAA, sizeof(black));
+  memset(red, 0xF0, sizeof(red));
+
+  if (wake) {
+    printf("panel,op,panel_us\n");
+    BenchWake<Epd1in54b, Epd1in54bTraits>("1in54b");
+    BenchWake<Epd2in13b, Epd2in13bTraits>("2in13b");
+    BenchWake<Epd2in7b, Epd2in7bTraits>("2in7b");
+    BenchWake<Epd2in9b, Epd2in9bTraits>("2in9b");
+    BenchWake<Epd4in2b, Epd4in2bTraits>("4in2b");
+    BenchWake<Epd7in5b, Epd7in5bTraits>("7in5b");
+    return 0;
+  }
+  if (bands) {
+    printf("panel,band_rows,bands,band_bytes,list_bytes,ns_per_frame,ns_per_band\n");
+    BenchBands<Epd1in54b, Epd1in54bTraits>("1in54b");
+    BenchBands<Epd2in13b, Epd2in13bTraits>("2in13b");
+    BenchBands<Epd2in7b, Epd2in7bTraits>("2in7b");
+    BenchBands<Epd2in9b, Epd2in9bTraits>("2in9b");
+    BenchBands<Epd4in2b, Epd4in2bTraits>("4in2b");
+    BenchBands<Epd7in5b, Epd7in5bTraits>("7in5b");
+    return 0;
+  }
+  if (io) {
+    printf("panel,op,pin_writes,busy_reads,spi_messages,spi_bytes\n");
+    CountPanel<Epd1in54b, Epd1in54bTraits>("1in54b");
+    CountPanel<Epd2in13b, Epd2in13bTraits>("2in13b");
+    CountPanelAsync<Epd2in13b, Epd2in13bTraits>("2in13b");
+    CountPanel<Epd2in7b, Epd2in7bTraits>("2in7b");
+    CountPanelAsync<Epd2in7b, Epd2in7bTraits>("2in7b");
+    CountPanel<Epd2in9b, Epd2in9bTraits>("2in9b");
+    CountPanelAsync<Epd2in9b, Epd2in9bTraits>("2in9b");
+    CountPanel<Epd4in2b, Epd4in2bTraits>("4in2b");
+    CountPanelAsync<Epd4in2b, Epd4in2bTraits>("4in2b");
+    CountPanel<Epd7in5b, Epd7in5bTraits>("7in5b");
+    return 0;
+  }
+
+  printf("panel,orientation,op,iterations,ns_per_op,pixels_per_s\n");
+  BenchPanel<Epd1in54b, Epd1in54bTraits>("1in54b");
+  BenchPanel<Epd2in13b, Epd2in13bTraits>("2in13b");
+  BenchPanel<Epd2in7b, Epd2in7bTraits>("2in7b");
+  BenchPanel<Epd2in9b, Epd2in9bTraits>("2in9b");
+  BenchPanel<Epd4in2b, Epd4in2bTraits>("4in2b");
+  BenchPanel<Epd7in5b, Epd7in5bTraits>("7in5b");
+
+  // the 7.5" also takes packed 2bpp image halves
+  if (Selected("7in5b", "DisplayFrame_2bpp")) {
+    static unsigned char packed[640 * 384 / 4];
+    const unsigned char* halves[2] = { packed, packed + sizeof(packed) / 2 };
+    Epd7in5b epd;
+    memset(packed, 0x1B, sizeof(packed));
+    SimPanel.Configure<Epd7in5bTraits>();
+    SimPanel.SetDecoding(false);
+    epd.Init();
+    Bench("7in5b", "-", "DisplayFrame_2bpp", [&]() { epd.DisplayFrame(halves); epd.WaitUntilIdle(); });
+  }
+  return 0;
+}
+
+/* END OF FILE */
@@ -0,0 +1,175 @@
+/**
+ *  @filename   :   epdtrace.cpp
+ *  @brief      :   Offline analysis of a trace dumped by EpdTrace::WriteTo().
+ *                  Replays it into the simulated panel and prints time,
+ *                  bytes, commands, fixed delays and BUSY waits for each
+ *                  phase of the update (init, LUT upload, plane upload,
+ *                  refresh, sleep).
+ *
+ *  Build with
+ *    g++ -O2 -DEPDIF_SIM -Isrc/linux -Isrc tools/epdtrace/epdtrace.cpp \
+ *        src/linux/sim.cpp src/epdif.cpp src/epdpaint.cpp src/epddiff.cpp \
+ *        src/epddisplaylist.cpp src/epdtrace.cpp src/font*.c -o epdtrace
+ *
+ *  Usage
+ *    epdtrace <1in54b|2in13b|2in7b|2in9b|4in2b|7in5b> <trace file>
+ *
+ *  Data runs are recorded without their content, the simulated SRAM only
+ *  gets their first byte repeated, so the tool reports timing and
+ *  protocol, not the image.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#define EPD_MULTI_PANEL
+
+#include <stdio.h>
+#include "epd1in54b.h"
+#include "epd2in13b.h"
+#include "epd2in7b.h"
+#include "epd2in9b.h"
+#include "epd4in2b.h"
+#include "epd7in5b.h"
+#include "epdsim.h"
+
+enum PHASE {
+  PHASE_INIT,
+  PHASE_LUT,
+  PHASE_UPLOAD,
+  PHASE_REFRESH,
+  PHASE_SLEEP,
+  PHASE_COUNT,
+};
+
+static const char* phaseNames[PHASE_COUNT] = { "init", "lut", "upload", "refresh", "sleep" };
+
+struct PhaseStats {
+  uint64_t timeUs;
+  uint64_t waitUs;
+  uint32_t delayMs;
+  uint32_t bytes;
+  uint32_t commands;
+  uint32_t entered;
+};
+
+static bool Configure(const char* model) {
+  if (!strcmp(model, "1in54b")) return SimPanel.Configure<Epd1in54bTraits>();
+  if (!strcmp(model, "2in13b")) return SimPanel.Configure<Epd2in13bTraits>();
+  if (!strcmp(model, "2in7b"))  return SimPanel.Configure<Epd2in7bTraits>();
+  if (!strcmp(model, "2in9b"))  return SimPanel.Configure<Epd2in9bTraits>();
+  if (!strcmp(model, "4in2b"))  return SimPanel.Configure<Epd4in2bTraits>();
+  if (!strcmp(model, "7in5b"))  return SimPanel.Configure<Epd7in5bTraits>();
+  return false;
+}
+
+/**
+ *  @brief: the phase a command starts, or -1 if it continues the current one
+ */
+static int CommandPhase(unsigned char command) {
+  if (command >= 0x20 && command <= 0x2F) return PHASE_LUT;
+  switch (command) {
+    case 0x10: case 0x13: case 0x14: case 0x15:   // DATA_START_TRANSMISSION_x
+    case 0x90: case 0x91: case 0x92:              // PARTIAL_WINDOW/IN/OUT
+      return PHASE_UPLOAD;
+    case 0x02: case 0x07:                         // POWER_OFF, DEEP_SLEEP
+      return PHASE_SLEEP;
+  }
+  return -1;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3 || !Configure(argv[1])) {
+    fprintf(stderr, "usage: %s <1in54b|2in13b|2in7b|2in9b|4in2b|7in5b> <trace file>\n", argv[0]);
+    return 2;
+  }
+  FILE* f = fopen(argv[2], "rb");
+  uint32_t header[2];
+  if (f == NULL || fread(header, sizeof(header), 1, f) != 1 || header[0] != EPD_TRACE_MAGIC) {
+    fprintf(stderr, "%s: not a trace\n", argv[2]);
+    return 1;
+  }
+
+  // the trace has the real BUSY times, the simulator only decodes
+  SimPanel.Timing().refreshUs = 0;
+  SimPanel.Timing().partialRefreshUs = 0;
+  SimPanel.Timing().powerOnUs = 0;
+  SimPanel.Timing().powerOffUs = 0;
+
+  PhaseStats stats[PHASE_COUNT];
+  memset(stats, 0, sizeof(stats));
+  int phase = PHASE_INIT;
+  bool waiting = false;
+  uint32_t refreshes = 0;
+  uint32_t first = 0, last = 0;
+  EpdTraceRecord r;
+
+  for (uint32_t i = 0; i < header[1] && fread(&r, sizeof(r), 1, f) == 1; i++) {
+    if (i == 0) first = last = r.time;
+
+    uint32_t delta = r.time - last;
+    stats[phase].timeUs += delta;
+    if (waiting) stats[phase].waitUs += delta;
+    SimPanel.Advance(delta);
+    last = r.time;
+
+    int next = -1;
+    switch (r.type) {
+      case EPD_TRACE_PIN:
+        if (r.value == EPD_TRACE_PIN_RST && !r.len) {
+          SimPanel.Reset();
+          next = PHASE_INIT;
+        }
+        break;
+      case EPD_TRACE_COMMAND:
+        SimPanel.Command(r.value);
+        next = CommandPhase(r.value);
+        if (next < 0 && phase == PHASE_LUT) next = PHASE_INIT;
+        break;
+      case EPD_TRACE_DATA:
+      case EPD_TRACE_FILL:
+        SimPanel.Data(r.value, r.len);
+        stats[phase].bytes += r.len;
+        break;
+      case EPD_TRACE_DELAY:
+        stats[phase].delayMs += r.len;
+        break;
+      case EPD_TRACE_WAIT_BEGIN:
+        waiting = true;
+        break;
+      case EPD_TRACE_WAIT_END:
+        waiting = false;
+        break;
+    }
+    if (SimPanel.GetRefreshCount() + SimPanel.GetPartialRefreshCount() != refreshes) {
+      refreshes = SimPanel.GetRefreshCount() + SimPanel.GetPartialRefreshCount();
+      next = PHASE_REFRESH;
+    }
+    if (next >= 0 && next != phase) {
+      phase = next;
+      stats[phase].entered++;
+    }
+    if (r.type == EPD_TRACE_COMMAND) stats[phase].commands++;
+  }
+  fclose(f);
+
+  printf("%-8s %10s %10s %10s %8s %8s\n", "phase", "time_ms", "wait_ms", "delay_ms", "bytes", "commands");
+  PhaseStats total;
+  memset(&total, 0, sizeof(total));
+  for (int p = 0; p < PHASE_COUNT; p++) {
+    printf("%-8s %10.1f %10.1f %10u %8u %8u\n", phaseNames[p], stats[p].timeUs / 1000.0, stats[p].waitUs / 1000.0,
+           (unsigned)stats[p].delayMs, (unsigned)stats[p].bytes, (unsigned)stats[p].commands);
+    total.timeUs += stats[p].timeUs;
+    total.waitUs += stats[p].waitUs;
+    total.delayMs += stats[p].delayMs;
+    total.bytes += stats[p].bytes;
+    total.commands += stats[p].commands;
+  }
+  printf("%-8s %10.1f %10.1f %10u %8u %8u\n", "total", total.timeUs / 1000.0, total.waitUs / 1000.0,
+         (unsigned)total.delayMs, (unsigned)total.bytes, (unsigned)total.commands);
+  printf("%u records over %.1f ms, %u full and %u partial refreshes, %u sent while asleep\n",
+         (unsigned)header[1], (last - first) / 1000.0, (unsigned)SimPanel.GetRefreshCount(),
+         (unsigned)SimPanel.GetPartialRefreshCount(), (unsigned)SimPanel.GetViolations());
+  return 0;
+}
+
+/* END OF FILE */
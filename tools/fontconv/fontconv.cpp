@@ -0,0 +1,384 @@
+/**
+ *  @filename   :   fontconv.cpp
+ *  @brief      :   Converts a fixed cell sFONT table or a BDF font into the
+ *                  proportional pFONT format (see fonts.h) and prints it as
+ *                  a C source file. Every glyph is cropped to its bounding
+ *                  box and its rows are bit-packed without padding.
+ *
+ *  Build with
+ *    g++ -O2 -Isrc/linux -Isrc tools/fontconv/fontconv.cpp \
+ *        src/font*.c -o fontconv
+ *
+ *  Usage
+ *    fontconv sfont <Font8|Font12|Font16|Font20|Font24> <name> [-t text] > <name>.c
+ *    fontconv bdf <file.bdf> <name> [first last] [-t text] > <name>.c
+ *
+ *  sFONT glyphs are monospaced, they get the width of their box plus one
+ *  column as advance, blank ones half the cell. BDF glyphs keep their
+ *  DWIDTH and offsets, first and last (default 32 and 126, 0x prefix for
+ *  hex) select the code points. With -t only the code points used in the
+ *  UTF-8 file text are taken, plus ' ' and the '?' fallback.
+ *
+ *  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fonts.h"
+
+#define MAX_GLYPHS     1024
+#define MAX_CODE       0xFFFF   // pRANGE limit
+#define MAX_SIZE       64
+#define MAX_BITMAP     65535    // pGLYPH.Offset limit
+
+struct Glyph {
+  int      code;
+  int      width;               // box as read, cropped by Crop()
+  int      height;
+  int      xOffset;
+  int      yOffset;             // box top below the line top
+  int      xAdvance;
+  uint8_t  bits[MAX_SIZE][MAX_SIZE];
+};
+
+static Glyph   glyphs[MAX_GLYPHS];  // sorted by code point before Write()
+static int     count;
+static bool    wanted[MAX_CODE + 1];
+static uint8_t bitmap[MAX_BITMAP];
+static int     lineHeight;
+static int     ascent;
+
+/**
+ *  @brief: the next glyph slot, NULL once they are used up
+ */
+static Glyph* AddGlyph(int code) {
+  if (count == MAX_GLYPHS) {
+    fprintf(stderr, "more than %d glyphs\n", MAX_GLYPHS);
+    return NULL;
+  }
+  Glyph* g = &glyphs[count++];
+  memset(g, 0, sizeof(*g));
+  g->code = code;
+  return g;
+}
+
+static Glyph* FindGlyph(int code) {
+  for (int i = 0; i < count; i++) {
+    if (glyphs[i].code == code) return &glyphs[i];
+  }
+  return NULL;
+}
+
+/**
+ *  @brief: marks the code points of a UTF-8 file as wanted,
+ *          anything outside the 16 bit range is left out
+ */
+static bool ReadText(const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "%s: can't open\n", path);
+    return false;
+  }
+
+  int c, code = 0, extra = 0;
+
+  while ((c = fgetc(f)) != EOF) {
+    if ((c & 0xC0) == 0x80) {
+      code = code << 6 | (c & 0x3F);
+      if (extra > 0 && --extra == 0 && code <= MAX_CODE) wanted[code] = true;
+      continue;
+    }
+    if (c < 0x80)      { code = c;        extra = 0; }
+    else if (c < 0xE0) { code = c & 0x1F; extra = 1; }
+    else if (c < 0xF0) { code = c & 0x0F; extra = 2; }
+    else               { code = c & 0x07; extra = 3; }
+    if (extra == 0 && c >= ' ') wanted[c] = true;
+  }
+  fclose(f);
+  wanted[' '] = wanted['?'] = true;
+  return true;
+}
+
+static int CompareCode(const void* a, const void* b) {
+  return ((const Glyph*)a)->code - ((const Glyph*)b)->code;
+}
+
+/**
+ *  @brief: trims blank rows and columns off the box of a glyph
+ */
+static void Crop(Glyph& g) {
+  int x0 = g.width, y0 = g.height, x1 = -1, y1 = -1;
+
+  for (int y = 0; y < g.height; y++) {
+    for (int x = 0; x < g.width; x++) {
+      if (!g.bits[y][x]) continue;
+      if (x < x0) x0 = x;
+      if (x > x1) x1 = x;
+      if (y < y0) y0 = y;
+      if (y > y1) y1 = y;
+    }
+  }
+  if (x1 < 0) {
+    g.width = g.height = g.xOffset = g.yOffset = 0;
+    return;
+  }
+  for (int y = y0; y <= y1; y++) {
+    for (int x = x0; x <= x1; x++) g.bits[y - y0][x - x0] = g.bits[y][x];
+  }
+  g.xOffset += x0;
+  g.yOffset += y0;
+  g.width = x1 - x0 + 1;
+  g.height = y1 - y0 + 1;
+}
+
+static const sFONT* FindFont(const char* name) {
+  if (!strcmp(name, "Font8"))  return &Font8;
+  if (!strcmp(name, "Font12")) return &Font12;
+  if (!strcmp(name, "Font16")) return &Font16;
+  if (!strcmp(name, "Font20")) return &Font20;
+  if (!strcmp(name, "Font24")) return &Font24;
+  return NULL;
+}
+
+/**
+ *  @brief: takes the glyphs ' ' to '~' of an sFONT table, the baseline is
+ *          the bottom of 'A'
+ */
+static bool ReadSFont(const char* name) {
+  const sFONT* font = FindFont(name);
+  if (font == NULL) {
+    fprintf(stderr, "%s: no such sFONT\n", name);
+    return false;
+  }
+
+  int rowBytes = (font->Width + 7) / 8;
+  lineHeight = font->Height;
+  for (int c = ' '; c < ' ' + FONT_GLYPHS; c++) {
+    Glyph& g = *AddGlyph(c);
+    const uint8_t* cell = font->table + (c - ' ') * font->Height * rowBytes;
+
+    g.width = font->Width;
+    g.height = font->Height;
+    g.xOffset = g.yOffset = 0;
+    for (int y = 0; y < g.height; y++) {
+      for (int x = 0; x < g.width; x++) g.bits[y][x] = (cell[y * rowBytes + x / 8] >> (7 - x % 8)) & 1;
+    }
+    Crop(g);
+    g.xAdvance = g.width ? g.width + 1 : (font->Width + 1) / 2;
+    g.xOffset = 0;
+  }
+  Glyph* a = FindGlyph('A');
+  ascent = a->yOffset + a->height;
+
+  int kept = 0;
+  for (int i = 0; i < count; i++) {
+    if (wanted[glyphs[i].code]) glyphs[kept++] = glyphs[i];
+  }
+  count = kept;
+  return true;
+}
+
+/**
+ *  @brief: reads the wanted glyphs of a BDF file, ENCODING is taken as
+ *          the code point
+ */
+static bool ReadBdf(const char* path) {
+  FILE* f = fopen(path, "r");
+  if (f == NULL) {
+    fprintf(stderr, "%s: can't open\n", path);
+    return false;
+  }
+
+  char line[1024];
+  int fontHeight = 0, fontYOffset = 0, descent = -1;
+  int encoding = -1, advance = 0, w = 0, h = 0, xo = 0, yo = 0, row = -1;
+  Glyph* g = NULL;
+  ascent = -1;
+
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (row >= 0 && strncmp(line, "ENDCHAR", 7) != 0) {
+      if (g != NULL && row < h) {
+        for (int x = 0; x < w; x++) {
+          char digit[2] = { line[x / 4], 0 };
+          g->bits[row][x] = (strtol(digit, NULL, 16) >> (3 - x % 4)) & 1;
+        }
+      }
+      row++;
+    }
+    else if (sscanf(line, "FONTBOUNDINGBOX %*d %d %*d %d", &fontHeight, &fontYOffset) == 2) {}
+    else if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1) {}
+    else if (sscanf(line, "FONT_DESCENT %d", &descent) == 1) {}
+    else if (sscanf(line, "ENCODING %d", &encoding) == 1) {}
+    else if (sscanf(line, "DWIDTH %d", &advance) == 1) {}
+    else if (sscanf(line, "BBX %d %d %d %d", &w, &h, &xo, &yo) == 4) {
+      if (w > MAX_SIZE || h > MAX_SIZE) {
+        fprintf(stderr, "%s: glyph %d larger than %d pixels\n", path, encoding, MAX_SIZE);
+        fclose(f);
+        return false;
+      }
+    }
+    else if (!strncmp(line, "BITMAP", 6)) {
+      row = 0;
+      g = NULL;
+      if (encoding >= 0 && encoding <= MAX_CODE && wanted[encoding] && FindGlyph(encoding) == NULL) {
+        if ((g = AddGlyph(encoding)) == NULL) {
+          fclose(f);
+          return false;
+        }
+        g->width = w;
+        g->height = h;
+        g->xOffset = xo;
+        g->yOffset = yo + h;    // box top above the baseline for now
+        g->xAdvance = advance;
+      }
+    }
+    else if (!strncmp(line, "ENDCHAR", 7)) {
+      row = -1;
+      g = NULL;
+    }
+  }
+  fclose(f);
+
+  if (ascent < 0) ascent = fontHeight + fontYOffset;
+  if (descent < 0) descent = -fontYOffset;
+  lineHeight = ascent + descent;
+  for (int i = 0; i < count; i++) {
+    glyphs[i].yOffset = ascent - glyphs[i].yOffset;
+    Crop(glyphs[i]);
+  }
+  return true;
+}
+
+/**
+ *  @brief: prints a code point as a comment
+ */
+static void PrintCode(int code) {
+  if (code > ' ' && code <= '~' && code != '\\' && code != '\'') printf("   // '%c'\n", code);
+  else printf("   // U+%04X\n", code);
+}
+
+/**
+ *  @brief: prints the font, the bitmap comes first so the glyph table can
+ *          point into it, then the runs of consecutive code points
+ */
+static bool Write(const char* name, const char* source) {
+  int offsets[MAX_GLYPHS];
+  int used = 0;
+  int ranges = 0;
+
+  if (count == 0) {
+    fprintf(stderr, "%s: no glyphs\n", name);
+    return false;
+  }
+  qsort(glyphs, count, sizeof(Glyph), CompareCode);
+  memset(bitmap, 0, sizeof(bitmap));
+  for (int i = 0; i < count; i++) {
+    const Glyph& g = glyphs[i];
+    int bit = 0;
+
+    if (i == 0 || g.code != glyphs[i - 1].code + 1) ranges++;
+    offsets[i] = used;
+    if (used + (g.width * g.height + 7) / 8 > MAX_BITMAP) {
+      fprintf(stderr, "%s: more than %d bytes of glyphs\n", name, MAX_BITMAP);
+      return false;
+    }
+    for (int y = 0; y < g.height; y++) {
+      for (int x = 0; x < g.width; x++, bit++) {
+        if (g.bits[y][x]) bitmap[used + bit / 8] |= 0x80 >> (bit % 8);
+      }
+    }
+    used += (bit + 7) / 8;
+  }
+
+  printf("/**\n");
+  printf(" *  @brief      :   %s, proportional, generated by tools/fontconv from %s\n", name, source);
+  printf(" */\n\n");
+  printf("#include \"fonts.h\"\n");
+  printf("#include <avr/pgmspace.h>\n\n");
+
+  printf("const uint8_t %s_Bitmap[] PROGMEM =\n{\n", name);
+  for (int i = 0; i < count; i++) {
+    int end = i + 1 < count ? offsets[i + 1] : used;
+    if (offsets[i] == end) continue;
+    printf("  ");
+    for (int b = offsets[i]; b < end; b++) printf("0x%02X,%s", bitmap[b], b + 1 < end ? " " : "");
+    PrintCode(glyphs[i].code);
+  }
+  printf("};\n\n");
+
+  printf("const pGLYPH %s_Glyphs[] PROGMEM =\n{\n", name);
+  printf("  // offset, width, height, xOffset, yOffset, xAdvance\n");
+  for (int i = 0; i < count; i++) {
+    const Glyph& g = glyphs[i];
+    printf("  { %5d, %3d, %3d, %3d, %3d, %3d },", offsets[i], g.width, g.height, g.xOffset, g.yOffset, g.xAdvance);
+    PrintCode(g.code);
+  }
+  printf("};\n\n");
+
+  printf("const pRANGE %s_Ranges[] PROGMEM =\n{\n", name);
+  printf("  // first, last, glyph\n");
+  for (int i = 0; i < count; ) {
+    int j = i;
+    while (j + 1 < count && glyphs[j + 1].code == glyphs[j].code + 1) j++;
+    printf("  { 0x%04X, 0x%04X, %4d },\n", glyphs[i].code, glyphs[j].code, i);
+    i = j + 1;
+  }
+  printf("};\n\n");
+
+  printf("pFONT %s = {\n", name);
+  printf("  %s_Bitmap,\n", name);
+  printf("  %s_Glyphs,\n", name);
+  printf("  %s_Ranges,\n", name);
+  printf("  %d, /* RangeCount */\n", ranges);
+  printf("  0x%04X, /* Fallback */\n", FindGlyph('?') != NULL ? '?' : 0);
+  printf("  %d, /* Height */\n", lineHeight);
+  printf("  %d, /* Ascent */\n", ascent);
+  printf("};\n");
+  fprintf(stderr, "%s: %d glyphs in %d ranges, %d bytes of bitmap, %d bytes of glyph and range tables\n",
+          name, count, ranges, used, count * (int)sizeof(pGLYPH) + ranges * (int)sizeof(pRANGE));
+  return true;
+}
+
+int main(int argc, char** argv) {
+  bool ok = false;
+  const char* text = NULL;
+  int first = 32;
+  int last = 126;
+
+  if (argc >= 6 && !strcmp(argv[argc - 2], "-t")) {
+    text = argv[argc - 1];
+    argc -= 2;
+  }
+  if (argc == 6) {
+    first = strtol(argv[4], NULL, 0);
+    last = strtol(argv[5], NULL, 0);
+  }
+  if (argc < 4 || (argc != 4 && argc != 6) || first < 0 || last > MAX_CODE || first > last) {
+    fprintf(stderr, "usage: %s sfont <Font8|Font12|Font16|Font20|Font24> <name> [-t text]\n", argv[0]);
+    fprintf(stderr, "       %s bdf <file.bdf> <name> [first last] [-t text]\n", argv[0]);
+    return 2;
+  }
+
+  if (text != NULL) {
+    if (!ReadText(text)) return 1;
+  }
+  else {
+    for (int c = first; c <= last; c++) wanted[c] = true;
+  }
+
+  if (!strcmp(argv[1], "sfont")) {
+    ok = ReadSFont(argv[2]);
+  }
+  else if (!strcmp(argv[1], "bdf")) {
+    ok = ReadBdf(argv[2]);
+  }
+  else {
+    fprintf(stderr, "%s: no such source, sfont or bdf\n", argv[1]);
+    return 2;
+  }
+  if (!ok || !Write(argv[3], argv[2])) return 1;
+  return 0;
+}
+
+/* END OF FILE */
@@ -0,0 +1,117 @@
+#!/bin/sh
+#
+#  @filename   :   epdsize.sh
+#  @brief      :   Code and data each panel driver adds to a sketch, built
+#                  for the host (x86-64, -Os) against the shims in src/linux.
+#                  Each panel gets a sketch making the calls every version
+#                  of its driver has, linked with --gc-sections, and the
+#                  sizes are what it adds to an empty main(). "multi" drives
+#                  all six panels from one sketch with EPD_MULTI_PANEL.
+#                  Prints CSV: config,text,data,bss
+#
+#                  tools/size/epdsize.sh [SRC_DIR]
+#
+#                  SRC_DIR defaults to src; for an older tree
+#                  git archive <rev> src | tar -x -C /tmp/old
+#                  tools/size/epdsize.sh /tmp/old/src
+#
+#  ePaper library by Jeremy Proffitt <proffitt.jeremy@gmail.com>
+#
+
+set -e
+SHIMS=$(cd "$(dirname "$0")/../../src/linux" && pwd)
+SRC=$(cd "${1:-$(dirname "$0")/../../src}" && pwd)
+CXX=${CXX:-g++}
+CC=${CC:-gcc}
+FLAGS="-Os -ffunction-sections -fdata-sections -DEPDIF_SIM -I$SHIMS -I$SRC"
+LINK="-no-pie -Wl,--gc-sections -Wl,--unresolved-symbols=ignore-all"
+PANELS="1in54b 2in13b 2in7b 2in9b 4in2b 7in5b"
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# what the original Waveshare drivers take from the sketch or from Particle
+cat > "$WORK/compat.h" <<END
+#define RST_PIN   8
+#define DC_PIN    9
+#define CS_PIN    10
+#define BUSY_PIN  7
+#define DEC       10
+struct EpdSizeSerial { void print(long value, int base); };
+extern EpdSizeSerial Serial;
+END
+DRIVER="-include $WORK/compat.h"
+
+# every source but the drivers goes into every sketch, the linker keeps what is used
+COMMON=""
+for f in "$SRC"/*.cpp "$SRC"/*.c; do
+  name=$(basename "$f")
+  case "$name" in epd[0-9]*|ePaper.cpp) continue;; esac
+  case "$name" in
+    *.c) $CC -std=c99 $FLAGS -c "$f" -o "$WORK/$name.o";;
+    *) $CXX -std=gnu++11 -fpermissive -w $FLAGS -c "$f" -o "$WORK/$name.o";;
+  esac
+  COMMON="$COMMON $WORK/$name.o"
+done
+for p in $PANELS; do
+  $CXX -std=gnu++11 -fpermissive -w $FLAGS $DRIVER -c "$SRC/epd$p.cpp" -o "$WORK/epd$p.o"
+done
+
+# the calls of one panel, the older drivers are all named Epd
+Calls() {
+  case "$1" in
+    1in54b) echo "$2.Init(); $2.DisplayFrame(black, red); $2.Sleep();";;
+    2in7b)  echo "$2.Init(); $2.TransmitPartial(black, red, 8, 8, 64, 64); $2.RefreshPartial(8, 8, 64, 64);"\
+                 "$2.DisplayFrame(black, red); $2.DisplayFrame(); $2.ClearFrame(); $2.Sleep();";;
+    7in5b)  echo "$2.Init(); $2.DisplayFrame(planes); $2.Sleep();";;
+    *)      echo "$2.Init(); $2.SetPartialWindow(black, red, 8, 8, 64, 64); $2.SetPartialWindowBlack(black, 8, 8, 64, 64);"\
+                 "$2.SetPartialWindowRed(red, 8, 8, 64, 64); $2.DisplayFrame(black, red); $2.DisplayFrame(); $2.ClearFrame(); $2.Sleep();";;
+  esac
+}
+
+Sketch() {
+  echo "#include <Arduino.h>"
+  echo "static unsigned char black[640 * 384 / 8], red[640 * 384 / 8];"
+  echo "static const unsigned char* planes[] = { black, red };"
+  echo "$1"
+  echo "int main(void) {"
+  echo "$2"
+  echo "return planes[0][0] + planes[1][0]; }"
+}
+
+Measure() {
+  $CXX -std=gnu++11 -fpermissive -w $FLAGS -c "$WORK/$1.cpp" -o "$WORK/$1.o"
+  $CXX $LINK "$WORK/$1.o" $2 -o "$WORK/$1"
+  size "$WORK/$1" | awk 'NR == 2 { print $1, $2, $3 }'
+}
+
+Sketch "" "" > "$WORK/empty.cpp"
+set -- $(Measure empty "")
+base_text=$1 base_data=$2 base_bss=$3
+
+echo "config,text,data,bss"
+Report() {
+  name=$1
+  set -- $(Measure "$1" "$2")
+  echo "$name,$(($1 - base_text)),$(($2 - base_data)),$(($3 - base_bss))"
+}
+for p in $PANELS; do
+  Sketch "#include <epd$p.h>
+Epd epd;" "$(Calls $p epd)" > "$WORK/$p.cpp"
+  Report $p "$WORK/epd$p.o $COMMON"
+done
+
+# the older drivers can't share a sketch
+if grep -q EPD_MULTI_PANEL "$SRC/epd4in2b.h"; then
+  includes="#define EPD_MULTI_PANEL"
+  calls=""
+  objects=""
+  for p in $PANELS; do
+    includes="$includes
+#include <epd$p.h>
+Epd$p epd$p;"
+    calls="$calls $(Calls $p epd$p)"
+    objects="$objects $WORK/epd$p.o"
+  done
+  Sketch "$includes" "$calls" > "$WORK/multi.cpp"
+  Report multi "$objects $COMMON"
+fi